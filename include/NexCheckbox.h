@@ -59,6 +59,7 @@ public: /* methods */
      * @return true if success, false for failure
      */
     bool setValue(uint32_t number);
+
 	
     /**
      * Get bco attribute of component
@@ -25,6 +25,14 @@
  * @{ 
  */
 
+/**
+ * Define baud calibration (Nextion::calibrateBaud) round trips per baud rate,
+ * and link error limit per monitoring window (ms) which makes baud to fall back to lower rate
+ */
+#define NEX_CALIBRATION_ROUNDS 8
+#define NEX_LINK_ERROR_LIMIT 3
+#define NEX_LINK_MONITOR_WINDOW 1000
+
 /**
  * Define serial communication default baud.
  * it is recommended that do not change defaul baud on Nextion, because it can forgot it on re-start
@@ -33,8 +41,16 @@
 */
 #define NEX_SERIAL_DEFAULT_BAUD 9600
 
+/**
+ * Define to address components with shortest valid form, name (page0.n0) or id (p[0].b[3]),
+ * page and component ids of the components must match HMI file.
+ * Names are used by default.
+ */
+//#define NEX_SHORTEST_ADDRESSING
+
 /**
  * Define standard (dafault) or fast timeout,  you may use fast timeout in case of baudrate higher than 115200
+ * Timeouts are defaults, they can be changed per Nextion instance with Nextion::setConfig
  * 
 */
 #define NEX_TIMEOUT_STANDARD
@@ -50,6 +66,86 @@
 
 #define NEX_TIMEOUT_TRANSPARENT_DATA_MODE 400
 
+/**
+ * Timeout parameter value which selects timeout of Nextion instance configuration (Nextion::setConfig)
+ */
+#define NEX_TIMEOUT_DEFAULT ((size_t)-1)
+
+/**
+ * Define time how long late reply to timed out request is waited, after that the reply is considered lost
+ * and maximum number of timed out requests tracked. Late reply must arrive before next command is sent.
+ */
+#define NEX_TIMEOUT_LATE_REPLY 1000
+#define NEX_MAX_ABANDONED_REQUESTS 4
+
+/**
+ * Define default retry policy of idempotent commands (assignments and queries), see NexRetryPolicy
+ * and maximum length of command which can be retried
+ */
+#define NEX_RETRY_MAX           2
+#define NEX_RETRY_BACKOFF       10
+#define NEX_RETRY_MAX_BACKOFF   100
+#define NEX_RETRY_DEADLINE      1000
+#define NEX_RETRY_COMMAND_SIZE  48
+
+/**
+ * Define size of listener pool shared by all components (NexTouch::addPushListener etc.)
+ */
+#define NEX_MAX_LISTENERS 8
+
+/**
+ * Define maximum wait time for next byte when skipping unexpected data to the next frame terminator
+ */
+#define NEX_TIMEOUT_RESYNC 20
+
+/**
+ * Define maximum number of application defined (custom) event frame types per Nextion instance
+ * see Nextion::registerCustomEvent
+ */
+#define NEX_MAX_CUSTOM_EVENTS 4
+
+/**
+ * Define maximum size of received event frame, including header and 0xFF 0xFF 0xFF terminator
+ * Longer custom event frames are discarded
+ */
+#define NEX_MAX_EVENT_FRAME_SIZE 16
+
+/**
+ * Define size of receive buffer per Nextion instance, serial data is read to it in bulk before parsing
+ */
+#define NEX_RX_BUFFER_SIZE 32
+
+/**
+ * Define chunk size used when received string is passed to string sink
+ */
+#define NEX_STRING_CHUNK_SIZE 16
+
+/**
+ * Define size of outgoing command queue per Nextion instance (postCommand)
+ * Every queued command takes command length + 7 bytes
+ */
+#define NEX_COMMAND_QUEUE_SIZE 96
+
+/**
+ * Define default receive buffer size of Nextion serial port used in overflow detection
+ * AVR HardwareSerial and SoftwareSerial 64, ESP8266 HardwareSerial 256
+ * Can be changed per instance with Nextion::setSerialRxBufferSize
+ */
+#define NEX_SERIAL_RX_BUFFER_SIZE 64
+
+/**
+ * Define size of received event frame buffer per Nextion instance
+ * Every queued frame takes frame length + 5 bytes, frames which do not fit
+ * wait in serial receive buffer until handled frames are released
+ */
+#define NEX_EVENT_BUFFER_SIZE 96
+
+/**
+ * Define header byte of the value change frame sent by HMI, see NexTouch::attachValueChange
+ * Frame: header, page id (1 byte), component id (1 byte), value (4 bytes, little endian), 0xFF 0xFF 0xFF
+ */
+#define NEX_RET_VALUE_CHANGE_HEAD 0x72
+
 
 /** 
  * Define DEBUG_SERIAL_ENABLE to enable debug serial. 
@@ -66,6 +162,12 @@
 // Enable Next TFT file upload functionality
 //#define NEX_ENABLE_TFT_UPLOAD
 
+// Enable runtime component discovery (NexRegistry), registry size in components
+// and EEPROM address of registry cache
+//#define NEX_ENABLE_DISCOVERY
+#define NEX_REGISTRY_SIZE 32
+#define NEX_DISCOVERY_EEPROM_ADDRESS 0
+
 // Enable HardwareSerial support by definign NEX_ENABLE_HW_SERIAL
 #define NEX_ENABLE_HW_SERIAL
 
@@ -75,6 +177,52 @@
 #define NEX_ENABLE_SW_SERIAL
 
 
+/**
+ * Enable blocking time profiler of component calls (NexProfiler.h)
+ * and define number of call sites and maximum call site name length
+ */
+//#define NEX_ENABLE_PROFILER
+#define NEX_PROFILER_SITES 16
+#define NEX_PROFILER_SITE_SIZE 24
+
+/**
+ * Define binary log level (NexLog.h), records above the level are compiled out
+ * 0 off, 1 error, 2 warning, 3 info, 4 debug
+ * and log ring buffer size in records (9 bytes each)
+ */
+#define NEX_LOG_LEVEL 0
+#define NEX_LOG_BUFFER_RECORDS 16
+
+/**
+ * Define default gesture recognition thresholds (NexGesture), can be changed per instance
+ * distances in pixels, times in ms
+ */
+#define NEX_GESTURE_TAP_SLOP 10
+#define NEX_GESTURE_SWIPE_DISTANCE 50
+#define NEX_GESTURE_SWIPE_TIME 500
+#define NEX_GESTURE_LONG_PRESS_TIME 700
+#define NEX_GESTURE_DOUBLE_TAP_TIME 300
+
+/**
+ * Define virtual hotspot grid (NexHotspotGrid) size in cells and number of region cell links,
+ * region takes one link per grid cell it overlaps. Link takes 4 bytes (8 on 32 bit targets)
+ * of NexHotspotGrid, AVR default fits small layouts only.
+ */
+#define NEX_HOTSPOT_GRID_COLUMNS 8
+#define NEX_HOTSPOT_GRID_ROWS 8
+#ifdef __AVR__
+#define NEX_HOTSPOT_LINKS 96
+#else
+#define NEX_HOTSPOT_LINKS 512
+#endif
+
+/**
+ * Define host timer wheel (NexTimerWheel) default tick (ms) and slots per level as bits,
+ * 3 levels cover 2^(3*bits) ticks, longer timers are rescheduled
+ */
+#define NEX_TIMER_WHEEL_TICK 10
+#define NEX_TIMER_WHEEL_SLOT_BITS 5
+
 #ifdef DEBUG_SERIAL_ENABLE
 #define dbSerialPrint(a)    dbSerial.print(a)
 #define dbSerialPrintln(a)  dbSerial.println(a)
@@ -0,0 +1,62 @@
+/**
+ * @file NexEeprom.h
+ *
+ * The definition of class NexEeprom. 
+ *
+ * @author Enhanced-Nextion-Library contributors 10/18/2026
+ * 
+ * @copyright 2026 Enhanced-Nextion-Library contributors
+ */
+
+#pragma once
+
+#include "NextionIf.h"
+#include "NexSpan.h"
+
+class Nextion;
+
+/**
+ * @addtogroup Component 
+ * @{ 
+ */
+
+/**
+ * Nextion EEPROM (Enhanced models), bulk access with wept / rept transparent data commands
+ */
+class NexEeprom:public NextionIf
+{
+    NexEeprom()=delete;
+
+public:
+
+    /**
+     * Constructor. 
+     *
+     * @param nextion - nextion interface
+     */
+    NexEeprom(Nextion *nextion);
+
+    ~NexEeprom();
+
+    /**
+     * Write bytes to EEPROM
+     *
+     * @param address - EEPROM start address
+     * @param data - bytes to write
+     * @return true if success, false for failure
+     */
+    bool write(uint16_t address, NexSpan<const uint8_t> data);
+
+    /**
+     * Read bytes from EEPROM
+     *
+     * @param address - EEPROM start address
+     * @param data - buffer to fill, data.size() bytes are read
+     * @return true if success, false for failure
+     */
+    bool read(uint16_t address, NexSpan<uint8_t> data);
+};
+
+/**
+ * @}
+ */
@@ -0,0 +1,156 @@
+/**
+ * @file NexGesture.h
+ *
+ * The definition of class NexGesture. 
+ *
+ * @author Enhanced-Nextion-Library contributors 10/18/2026
+ * 
+ * @copyright 2026 Enhanced-Nextion-Library contributors
+ */
+
+#pragma once
+
+#include "NextionIf.h"
+#include "NexHardware.h"
+
+/**
+ * @addtogroup Component 
+ * @{ 
+ */
+
+/**
+ * Recognized gesture types
+ */
+enum NexGestureType : uint8_t
+{
+    NEX_GESTURE_TAP,
+    NEX_GESTURE_DOUBLE_TAP,
+    NEX_GESTURE_LONG_PRESS,
+    NEX_GESTURE_DRAG,           // dx, dy delta from previous drag sample
+    NEX_GESTURE_SWIPE_LEFT,
+    NEX_GESTURE_SWIPE_RIGHT,
+    NEX_GESTURE_SWIPE_UP,
+    NEX_GESTURE_SWIPE_DOWN
+};
+
+/**
+ * Recognized gesture
+ */
+struct NexGestureEvent
+{
+    NexGestureType type;
+    uint16_t x;         // touch start x
+    uint16_t y;         // touch start y
+    int16_t dx;         // swipe: total movement, drag: delta
+    int16_t dy;
+    uint32_t duration;  // from touch start (ms), double tap: from first touch start
+    uint32_t latency;   // from the sample (or time threshold) which completed the gesture to recognition (us)
+};
+
+/**
+ * Gesture recognition thresholds, distances in pixels, times in ms
+ */
+struct NexGestureConfig
+{
+    uint16_t tapSlop{NEX_GESTURE_TAP_SLOP};             // maximum movement of tap, drag starts beyond it
+    uint16_t swipeDistance{NEX_GESTURE_SWIPE_DISTANCE}; // minimum movement of swipe
+    uint16_t swipeTime{NEX_GESTURE_SWIPE_TIME};         // maximum duration of swipe
+    uint16_t longPressTime{NEX_GESTURE_LONG_PRESS_TIME};
+    uint16_t doubleTapTime{NEX_GESTURE_DOUBLE_TAP_TIME};// maximum time from first release to second press
+};
+
+/**
+ * Type of gesture callback function
+ *
+ * @param gesture - recognized gesture
+ * @param ptr - user pointer given in attachGesture
+ */
+typedef void (*NexGestureCb)(const NexGestureEvent &gesture, void *ptr);
+
+/**
+ * Gesture recognizer over touch coordinate stream (sendxy=1)
+ *
+ * Press samples received while touch is down are handled as move samples,
+ * these are sent e.g. from HMI Touch Move event. Per sample cost is constant.
+ * Single tap is reported when double tap time has passed without second tap.
+ */
+class NexGesture:public NextionIf, public NexCoordinateListener
+{
+    NexGesture()=delete;
+
+public:
+    /**
+     * Constructor, registers recognizer to nextion coordinate listeners
+     *
+     * @param nextion - nextion interface
+     */
+    NexGesture(Nextion *nextion);
+
+    ~NexGesture();
+
+    /**
+     * Enable or disable touch coordinate sending of display (sendxy)
+     *
+     * @param enable - true enable
+     * @return true if success, false for failure
+     */
+    bool enable(bool enable = true);
+
+    /**
+     * Attach gesture callback
+     *
+     * @param gesture - callback called with recognized gesture
+     * @param ptr - parameter passed into gesture[default:nullptr]
+     */
+    void attachGesture(NexGestureCb gesture, void *ptr = nullptr);
+
+    /**
+     * Set recognition thresholds
+     *
+     * @param config - thresholds
+     */
+    void setConfig(const NexGestureConfig &config);
+
+    /**
+     * Get latency of last recognized gesture (us)
+     */
+    uint32_t GetLastLatency() const;
+
+    /**
+     * Get maximum latency of recognized gestures (us)
+     */
+    uint32_t GetMaxLatency() const;
+
+    void touchCoordinate(uint16_t x, uint16_t y, uint8_t event, uint32_t time) override;
+    void poll(uint32_t now) override;
+
+private:
+    void Emit(NexGestureType type, uint16_t x, uint16_t y, int16_t dx, int16_t dy, uint32_t duration, uint32_t completed);
+    void FlushTap(uint32_t completed);
+    void Release(uint16_t x, uint16_t y, uint32_t time);
+
+    Nextion *m_owner;
+    NexGestureConfig m_config;
+    NexGestureCb m_cb{nullptr};
+    void *m_cbPtr{nullptr};
+    bool m_down{false};
+    bool m_dragging{false};
+    bool m_longPressed{false};
+    bool m_tapPending{false};
+    uint16_t m_startX{0};
+    uint16_t m_startY{0};
+    uint16_t m_lastX{0};
+    uint16_t m_lastY{0};
+    uint32_t m_startTime{0};    // us
+    uint16_t m_tapX{0};         // pending tap, waiting possible second tap
+    uint16_t m_tapY{0};
+    uint32_t m_tapStart{0};     // us
+    uint32_t m_tapTime{0};      // us, release
+    uint32_t m_tapDuration{0};  // us
+    uint32_t m_lastLatency{0};
+    uint32_t m_maxLatency{0};
+};
+
+/**
+ * @}
+ */
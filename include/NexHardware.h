@@ -35,12 +35,243 @@
 #endif
 
 class NexTouch;
+class NexTimerWheel;
 
+/**
+ * @addtogroup CoreAPI 
+ * @{ 
+ */
+
+/**
+ * Nextion return codes
+ */
+#define NEX_RET_INVALID_CMD             (0x00)
+#define NEX_RET_CMD_FINISHED_OK         (0x01)
+#define NEX_RET_INVALID_COMPONENT_ID    (0x02)
+#define NEX_RET_INVALID_PAGE_ID         (0x03)
+#define NEX_RET_INVALID_PICTURE_ID      (0x04)
+#define NEX_RET_INVALID_FONT_ID         (0x05)
+#define NEX_RET_INVALID_FILE_OPERATION  (0x06)
+#define NEX_RET_INVALID_CRC             (0x09)
+#define NEX_RET_INVALID_BAUD            (0x11)
+#define NEX_RET_INVALID_WAVEFORM_ID_OR_CHANNEL_NRO  (0x12)
+#define NEX_RET_INVALID_VARIABLE_OR_ATTRIBUTE       (0x1A)
+#define NEX_RET_INVALID_VARIABLE_OPERATION          (0x1B)
+#define NEX_RET_ASSIGNMENT_FAILED_TO_ASSIGN         (0x1C)
+#define NEX_RET_EEPROM_OPERATION_FAILED             (0x1D)
+#define NEX_RET_INVALID_QUANTITY_OF_PARAMETERS      (0x1E)
+#define NEX_RET_IO_OPERATION_FAILED                 (0x1F)
+#define NEX_RET_ESCAPE_CHARACTER_INVALID            (0x20)
+#define NEX_RET_VARIABLE_NAME_TOO_LONG              (0x23)
+#define NEX_RET_SERIAL_BUFFER_OVERFLOW              (0x24)
+#define NEX_RET_NO_REPLY                            (0xFF)  // no (valid) reply received, library internal code
+
+/**
+ * Progress of Nextion initialization
+ */
+enum NexInitState : uint8_t
+{
+    NEX_INIT_IDLE,          // not started
+    NEX_INIT_CONNECT,       // connecting with default baud
+    NEX_INIT_FIND_BAUD,     // scanning supported baud rates
+    NEX_INIT_SET_BAUD,      // switching to requested baud
+    NEX_INIT_SETUP,         // setting reply mode and initial page
+    NEX_INIT_DONE,          // initialized successfully
+    NEX_INIT_FAILED         // display not found or not responding
+};
+
+/**
+ * Command classes for retry policy
+ */
+enum NexCommandClass : uint8_t
+{
+    NEX_CMD_ASSIGNMENT,     // attribute assignment of literal value e.g. n0.val=1, t0.txt="a", idempotent
+    NEX_CMD_QUERY,          // get command, idempotent
+    NEX_CMD_NON_IDEMPOTENT  // all other commands e.g. txt+=, n0.val=n0.val+1, add, never retried
+};
+
+/**
+ * Retry policy of failed commands
+ * 
+ * Command is retried when reply is not received or Nextion return code is
+ * invalid instruction or serial buffer overflow. Backoff time is doubled for every retry.
+ */
+struct NexRetryPolicy
+{
+    uint8_t maxRetries;     // maximum number of retries, 0 no retries
+    uint16_t backoff;       // wait time before first retry (ms)
+    uint16_t maxBackoff;    // maximum wait time before retry (ms)
+    uint16_t deadline;      // total time limit for command including retries (ms)
+};
+
+/**
+ * Command acknowledge mode (Nextion bkcmd)
+ */
+enum NexAckMode : uint8_t
+{
+    NEX_ACK_ALL = 3,        // success and failure replies, commands wait for reply
+    NEX_ACK_FAILURES = 2    // failure replies only, commands are not waited, failures are discarded in nexLoop
+};
+
+/**
+ * Nextion instance configuration, defaults from NexConfig.h
+ * 
+ * Capacities are clamped to compile time buffer sizes.
+ */
+struct NexInstanceConfig
+{
+    size_t commandTimeout{NEX_TIMEOUT_COMMAND};                         // ms
+    size_t returnTimeout{NEX_TIMEOUT_RETURN};                           // ms
+    size_t transparentDataModeTimeout{NEX_TIMEOUT_TRANSPARENT_DATA_MODE};// ms
+    uint32_t defaultBaud{NEX_SERIAL_DEFAULT_BAUD};                      // baud connected first and used when nexInit baud is not given
+    NexAckMode ackMode{NEX_ACK_ALL};
+    uint16_t commandQueueSize{NEX_COMMAND_QUEUE_SIZE};                  // max NEX_COMMAND_QUEUE_SIZE
+    uint16_t eventBufferSize{NEX_EVENT_BUFFER_SIZE};                    // max NEX_EVENT_BUFFER_SIZE
+    uint16_t serialRxBufferSize{NEX_SERIAL_RX_BUFFER_SIZE};             // serial port receive buffer size, overflow detection
+};
+
+/**
+ * @}
+ */
+
+
+/**
+ * View to received event frame
+ *
+ * Frame bytes are not copied, view points to the Nextion instance receive buffer
+ * and it is valid only during the event callback call.
+ */
+class NexEventFrame
+{
+public:
+    NexEventFrame():m_data{nullptr},m_length{0},m_time{0}{}
+    NexEventFrame(const uint8_t *data, uint8_t length, uint32_t time = 0):m_data{data},m_length{length},m_time{time}{}
+
+    /**
+     * Frame bytes, header byte first
+     */
+    const uint8_t* data() const {return m_data;}
+
+    /**
+     * Frame length including header and terminator bytes
+     */
+    uint8_t length() const {return m_length;}
+
+    /**
+     * Frame arrival time (micros), when frame was completely read from serial port
+     */
+    uint32_t time() const {return m_time;}
+
+    /**
+     * Frame header byte (event type)
+     */
+    uint8_t header() const {return m_data[0];}
+
+    uint8_t operator[](uint8_t i) const {return m_data[i];}
+
+    /**
+     * Is frame terminated by 0xFF 0xFF 0xFF
+     */
+    bool isTerminated() const
+    {
+        return m_length >= 4 && 0xFF == m_data[m_length-1] && 0xFF == m_data[m_length-2] && 0xFF == m_data[m_length-3];
+    }
+
+    /**
+     * Page id of touch (0x65), current page (0x66) and value change frames
+     */
+    uint8_t pageId() const {return m_data[1];}
+
+    /**
+     * Component id of touch (0x65) and value change frames
+     */
+    uint8_t componentId() const {return m_data[2];}
+
+    /**
+     * Touch event of touch (0x65) and coordinate (0x67, 0x68) frames, Press Event 0x01, Release Event 0X00 
+     */
+    uint8_t touchEvent() const {return m_length == 7 ? m_data[3] : m_data[5];}
+
+    /**
+     * x coordinate of coordinate (0x67, 0x68) frames, sent high byte first
+     */
+    uint16_t x() const {return ((uint16_t)m_data[1] << 8) | m_data[2];}
 
-struct nexQueuedEvent
+    /**
+     * y coordinate of coordinate (0x67, 0x68) frames
+     */
+    uint16_t y() const {return ((uint16_t)m_data[3] << 8) | m_data[4];}
+
+    /**
+     * Value of value change frame
+     */
+    int32_t value() const {return ((int32_t)m_data[6] << 24) | ((int32_t)m_data[5] << 16) | ((int32_t)m_data[4] << 8) | m_data[3];}
+
+private:
+    const uint8_t *m_data;
+    uint8_t m_length;
+    uint32_t m_time;
+};
+
+/**
+ * Type of callback function when application defined (custom) event frame is received.
+ *
+ * @param frame - received frame
+ * @param ptr - user pointer given in registration
+ */
+typedef void (*NexCustomEventCb)(const NexEventFrame &frame, void *ptr);
+
+/**
+ * Request which reply was not received in time
+ */
+struct nexAbandonedRequest
+{
+    uint8_t seq{0};         // request sequence number
+    uint8_t expected{0};    // expected reply header
+    uint32_t time{0};       // abandon time (ms)
+};
+
+/**
+ * Application defined (custom) event frame type, e.g. frame sent by printh from HMI
+ */
+struct nexCustomEvent
+{
+    uint8_t header{0};              // frame header byte
+    uint8_t length{0};              // fixed frame length, 0 frame is terminated by 0xFF 0xFF 0xFF
+    NexCustomEventCb callback{nullptr};
+    void *ptr{nullptr};
+};
+
+/**
+ * Receiver of touch coordinate (sendxy=1) stream, e.g. gesture recognizer
+ *
+ * Listeners are chained intrusively, listener can be registered to one Nextion instance.
+ */
+class NexCoordinateListener
 {
-    uint8_t event_data[10];
-    nexQueuedEvent *m_next{nullptr};
+public:
+    virtual ~NexCoordinateListener() {}
+
+    /**
+     * Touch coordinate received
+     *
+     * @param x - x coordinate
+     * @param y - y coordinate
+     * @param event - Press Event 0x01, Release Event 0X00
+     * @param time - frame receive time (micros)
+     */
+    virtual void touchCoordinate(uint16_t x, uint16_t y, uint8_t event, uint32_t time) =0;
+
+    /**
+     * Called from every nexLoop, time based recognition (e.g. long press)
+     *
+     * @param now - current time (micros)
+     */
+    virtual void poll(uint32_t /*now*/) {}
+
+private:
+    friend class Nextion;
+    NexCoordinateListener *m_nextCoordinateListener{nullptr};
 };
 
 /**
@@ -74,35 +305,365 @@ private: // methods
 bool connect();
 
 /**
- * resolve baud
+ * send connect request
+ */
+void SendConnect();
+
+/**
+ * switch display and serial port to new baud
  * 
- * @param baud - resolved baud rate
+ * @param baud - new baud rate
  * 
- * @return true if success, false for failure. 
+ * @return true if display replies with new baud
+ */
+bool SwitchBaud(uint32_t baud);
+
+/**
+ * set serial port baud and probe display until it replies
+ * 
+ * @param baud - baud rate
+ * 
+ * @return true if display replies with the baud
+ */
+bool ReconnectAt(uint32_t baud);
+
+/**
+ * round trip test values through sys0 variable
+ * 
+ * @param rounds - number of values
+ * 
+ * @return number of failed round trips
+ */
+uint8_t LinkTest(uint8_t rounds);
+
+/**
+ * fall back to lower baud if link errors exceed the limit
  */
-bool findBaud(uint32_t &baud);
+void CheckLinkQuality();
+
+/**
+ * (re)start serial port with given baud
+ * 
+ * @param baud - baud rate
+ */
+void SerialBegin(uint32_t baud);
+
+/**
+ * start connect attempt of init state machine
+ * 
+ * @param settle - time to wait before connect request (ms)
+ */
+void StartInitConnect(uint32_t settle);
+
+/**
+ * advance connect attempt of init state machine
+ * 
+ * @return 1 connected, 0 pending, -1 failed
+ */
+int8_t PollInitConnect();
+
+/**
+ * connection found, switch to requested baud if needed
+ */
+void InitConnected();
 
 enum serialType {HW, SW, HW_USBCON};
 
     const serialType m_nexSerialType; 
     Stream *m_nexSerial;
-    uint32_t m_baud;
+    NexInstanceConfig m_config;
+    uint32_t m_baud{NEX_SERIAL_DEFAULT_BAUD};
+
+    // bytes read from serial in bulk, not yet parsed
+    uint8_t m_rxBuffer[NEX_RX_BUFFER_SIZE];
+    uint16_t m_rxHead{0};
+    uint16_t m_rxCount{0};
+    uint32_t m_rxWaitTime{0};
+
+    // serial receive buffer level statistics
+    uint16_t m_rxHighWater{0};
+    bool m_rxFull{false};
+    uint32_t m_rxFullSamples{0};
+    uint32_t m_frameErrors{0};
+    uint32_t m_overflowSuspects{0};
+    uint32_t m_lastServiceTime{0};
+    uint32_t m_maxServiceInterval{0};
+    uint32_t m_eventTime{0};            // arrival of event being handled (us)
+    uint32_t m_eventCount{0};
+    uint32_t m_eventDelaySum{0};        // us, halved with count on overflow
+    uint32_t m_eventDelaySumCount{0};
+    uint32_t m_eventDelayMax{0};        // us
+    uint32_t m_eventHandlerMax{0};      // us
+
+    // init state machine
+    NexInitState m_initState{NEX_INIT_IDLE};
+    uint8_t m_initStep{0};
+    uint8_t m_initBaudIndex{0};
+    uint32_t m_initBaud{NEX_SERIAL_DEFAULT_BAUD};
+    uint32_t m_initTime{0};
+    uint32_t m_initStart{0};
+
+    // link quality monitoring after baud calibration
+    bool m_linkMonitor{false};
+    uint32_t m_linkMinBaud{NEX_SERIAL_DEFAULT_BAUD};
+    uint32_t m_linkErrors{0};
+    uint32_t m_linkWindowErrors{0};
+    uint32_t m_linkWindowStart{0};
+    uint32_t m_baudFallbacks{0};
+    uint32_t m_initSettle{0};
+
+    // received event frames, each frame is stored as length byte and arrival time followed by the frame,
+    // writing continues from buffer start when frames there are handled
+    uint8_t m_eventBuffer[NEX_EVENT_BUFFER_SIZE];
+    uint16_t m_eventBufferLen{0};
+    uint16_t m_eventBufferPos{0};
+    uint16_t m_eventBufferEnd{0};       // end of frames before wrap, 0 if not wrapped
+    uint16_t m_eventBufferInUse{0};     // frame being handled, space before it is free
 
-    nexQueuedEvent *m_queuedEvents{nullptr};
+    // outgoing commands, each stored as length byte, coalescing key length byte,
+    // expiry time (4 bytes, 0 no deadline) and '\0' terminated command
+    uint8_t m_commandQueue[NEX_COMMAND_QUEUE_SIZE];
+    uint16_t m_commandQueueLen{0};
+    bool m_commandQueueSending{false};
+    uint32_t m_coalescedCommands{0};
+    uint32_t m_failedPostedCommands{0};
+    uint32_t m_staleCommands{0};
+
+    nexCustomEvent m_customEvents[NEX_MAX_CUSTOM_EVENTS];
+    NexCoordinateListener *m_coordinateListeners{nullptr};
+    NexTimerWheel *m_timerWheel{nullptr};
+    uint8_t m_customEventCount{0};
+
+    // requests which reply may still arrive
+    nexAbandonedRequest m_abandoned[NEX_MAX_ABANDONED_REQUESTS];
+    uint8_t m_abandonedHead{0};
+    uint8_t m_abandonedCount{0};
+    uint8_t m_requestSeq{0};
+    uint32_t m_lateReplies{0};
+    uint32_t m_unexpectedReplies{0};
+    uint32_t m_skippedBytes{0};
+    uint32_t m_resyncCount{0};
+
+    // last idempotent command for retry
+    char m_retryCommand[NEX_RETRY_COMMAND_SIZE]{};
+    NexCommandClass m_retryCommandClass{NEX_CMD_NON_IDEMPOTENT};
+    NexRetryPolicy m_retryPolicy[NEX_CMD_NON_IDEMPOTENT]{
+        {NEX_RETRY_MAX, NEX_RETRY_BACKOFF, NEX_RETRY_MAX_BACKOFF, NEX_RETRY_DEADLINE},
+        {NEX_RETRY_MAX, NEX_RETRY_BACKOFF, NEX_RETRY_MAX_BACKOFF, NEX_RETRY_DEADLINE}};
+    uint8_t m_lastReturnCode{NEX_RET_CMD_FINISHED_OK};
+    uint32_t m_retryCount{0};
 
 /**
  * Read Queued event in the message queue
  * 
- * @retval none
+ * @retval true - event frame is waiting for room in event buffer
+ * @retval false - no event frame in receive buffer
+ */
+bool ReadQueuedEvents();
+
+/**
+ * Reserve event buffer space for next frame, reuses handled frame space
+ * 
+ * @param size - needed space
+ * 
+ * @return true if there is room at m_eventBufferLen
+ */
+bool ReserveEventSpace(uint16_t size);
+
+/**
+ * Find registered custom event
+ * 
+ * @param header - frame header byte
+ * 
+ * @retval nullptr if not registered
+ */
+const nexCustomEvent* FindCustomEvent(uint8_t header) const;
+
+/**
+ * Read 0xFF 0xFF 0xFF terminated frame
+ * 
+ * @param buffer - frame buffer, header byte is already in buffer[0]
+ * @param size - buffer size
+ * @param len - in / out frame length
+ * 
+ * @return true if success, false for failure. 
+ */
+bool ReadTerminatedFrame(uint8_t *buffer, uint16_t size, uint8_t &len);
+
+/**
+ * Skip reply frame
+ * 
+ * @param header - frame header
+ * 
+ * @return true if success, false for timeout. 
+ */
+bool SkipReplyFrame(uint8_t header);
+
+/**
+ * Mark current request abandoned, its late reply is discarded when received before next command
+ * 
+ * @param expected - expected reply header
+ */
+void AbandonRequest(uint8_t expected);
+
+/**
+ * Discard reply if it is late reply to an abandoned request
+ * 
+ * @param header - received reply header
+ * 
+ * @return true if reply is discarded
+ */
+bool DiscardLateReply(uint8_t header);
+
+/**
+ * Discard received replies, queued events are kept
+ */
+void DiscardReplies();
+
+/**
+ * Read available serial data to receive buffer in bulk
+ * 
+ * @return bytes in receive buffer
+ */
+size_t RxFill();
+
+/**
+ * Peek next received byte
+ * 
+ * @return next byte, -1 if no data
+ */
+int RxPeek();
+
+/**
+ * Peek received byte after next byte, waits the byte shortly
+ * 
+ * @param offset - byte offset from next byte, less than NEX_RX_BUFFER_SIZE
+ * 
+ * @return byte, -1 if not received
+ */
+int RxPeekAt(uint8_t offset);
+
+/**
+ * Read next received byte
+ * 
+ * @return next byte, -1 if no data
+ */
+int RxRead();
+
+/**
+ * Received bytes available
+ * 
+ * @return bytes in receive buffer and serial
+ */
+size_t RxAvailable();
+
+/**
+ * Wait more data from Nextion, using waitForDataCallback if set, otherwise yield
+ * 
+ * @param start - receive start time (ms)
+ * @param timeout - timeout ms
+ * 
+ * @return false if timeout is elapsed
+ */
+bool WaitForData(uint32_t start, size_t timeout);
+
+/**
+ * Resynchronize to the next 0xFF 0xFF 0xFF terminator after unexpected data
+ */
+void Resync();
+
+/**
+ * Wait reply to current request, late and unexpected replies are discarded
+ * 
+ * @param expected - expected reply header
+ * @param start - request start time (ms)
+ * @param timeout - timeout ms
+ * 
+ * @return received header (expected or error code), -1 for timeout
+ */
+int WaitReplyHeader(uint8_t expected, uint32_t start, size_t timeout);
+
+/**
+ * Receive fixed size reply to current request
+ * 
+ * @param expected - expected reply header
+ * @param buffer - receive buffer
+ * @param size - expected reply size
+ * @param timeout - timeout ms
+ * 
+ * @return read bytes, error reply size in case of error return code
+ */
+size_t RecvReply(uint8_t expected, uint8_t *buffer, size_t size, size_t timeout);
+
+/**
+ * Sample serial receive buffer level
+ * 
+ * @return bytes available in serial receive buffer
+ */
+size_t SampleRxLevel();
+
+/**
+ * Count frame integrity failure, failure after full receive buffer is likely overflow
+ */
+void FrameError();
+
+/**
+ * Retry last command according to its retry policy
+ * 
+ * Command is not resent when late reply of the failed attempt arrives during backoff.
+ * 
+ * @param attempt - in / out retry attempt
+ * @param start - command start time (ms)
+ * 
+ * @return true if reply is waited again, command was sent again or late reply arrived
+ */
+bool RetryCommand(uint8_t &attempt, uint32_t start);
+
+/**
+ * Receive string without retry
+ * 
+ * @param sink - called with received string chunks
+ * @param ptr - parameter passed into sink
+ * @param timeout - set timeout time.
+ * @param start_flag - is str start flag (0x70) expected
+ * @param str_len - out length of string passed to sink
+ * 
+ * @return true if success, false for failure
+ */
+bool RecvString(NexStringSinkCb sink, void *ptr, size_t timeout, bool start_flag, size_t &str_len);
+
+/**
+ * Drop queued commands which deadline has passed
+ * 
+ * @return true if any command was dropped
+ */
+bool DropStaleCommands();
+
+/**
+ * Check if assignment to the attribute of command is queued
+ * 
+ * @param cmd - command string
+ * 
+ * @return true if queued literal assignment has the same attribute
  */
-void ReadQueuedEvents();
+bool IsAssignmentQueued(const char *cmd) const;
 
 /**
  * Get Queued event from the message queue
  * 
- * @retval nullptr if no queued events to handle
+ * @param frame - view to the queued event frame
+ * 
+ * @retval false if no queued events to handle
+ */
+bool GetQueuedEvent(NexEventFrame &frame);
+
+/**
+ * Update event delay statistics when event handling starts
+ * 
+ * @param frame - event frame
+ * @param now - handling start time (micros)
  */
-nexQueuedEvent* GetQueuedEvent();
+void EventStarted(const NexEventFrame &frame, uint32_t now);
 
 public:
 
@@ -174,6 +735,24 @@ static Nextion* GetInstance(Serial_ &nexSerial);
 
 virtual ~Nextion();
 
+/**
+ * Wait for data callback function
+ * Called when library waits data from Nextion, if not set yield is called.
+ * Function can block until serial data is received (e.g. RTOS task notification from serial interrupt)
+ * or given maximum wait time is elapsed.
+ * 
+ * uint32_t maxWait - maximum wait time ms
+ */
+ void (*waitForDataCallback)(uint32_t);
+
+/**
+ * Event frame callback function
+ * Called for every received event frame before the event specific callbacks
+ * 
+ * const NexEventFrame &frame - view to received frame
+ */
+ void (*eventFrameCallback)(const NexEventFrame&);
+
 /**
  * Nextion Startup callback function
  * Returned when Nextion has started or reset
@@ -247,6 +826,59 @@ virtual ~Nextion();
  void (*startSdUpgradeCallback)();
 // std::function<void()> startSdUpgradeCallback;
 
+/**
+ * Register application defined (custom) event frame type
+ * 
+ * Custom frames are sent from HMI e.g. with printh and prints commands.
+ * Frame is queued and dispatched from nexLoop like the Nextion own events.
+ * 
+ * @param header - frame header byte, may not be Nextion own event or return code
+ * @param length - fixed frame length including header (and possible terminator),
+ *                 0 frame is terminated by 0xFF 0xFF 0xFF
+ * @param callback - called from nexLoop when frame is received
+ * @param ptr - parameter passed into callback [default:nullptr]
+ * 
+ * @return true if success, false for failure (reserved header, too long frame or registry full). 
+ */
+bool registerCustomEvent(uint8_t header, uint8_t length, NexCustomEventCb callback, void *ptr = nullptr);
+
+/**
+ * Unregister application defined (custom) event frame type
+ * 
+ * @param header - frame header byte
+ * 
+ * @return true if success, false if header was not registered. 
+ */
+bool unregisterCustomEvent(uint8_t header);
+
+/**
+ * Add touch coordinate listener
+ * 
+ * Listeners get coordinate frames (sendxy=1) after touchCoordinateCallback
+ * and are polled from every nexLoop.
+ * 
+ * @param listener - listener, must stay valid until removed
+ */
+void addCoordinateListener(NexCoordinateListener *listener);
+
+/**
+ * Remove touch coordinate listener
+ * 
+ * @param listener - listener
+ * 
+ * @return true if removed, false if listener was not added. 
+ */
+bool removeCoordinateListener(NexCoordinateListener *listener);
+
+/**
+ * Set host timer wheel polled from nexLoop
+ * 
+ * Expired timers are run after events are handled and before queued commands are sent.
+ * 
+ * @param wheel - timer wheel, nullptr to remove
+ */
+void setTimerWheel(NexTimerWheel *wheel);
+
 /* Receive unsigned number
 *
 * @param number - received value
@@ -255,7 +887,7 @@ virtual ~Nextion();
 * @retval true - success.
 * @retval false - failed. 
 */
-bool recvRetNumber(uint32_t *number, size_t timeout = NEX_TIMEOUT_RETURN) final;
+bool recvRetNumber(uint32_t *number, size_t timeout = NEX_TIMEOUT_DEFAULT) final;
 
 /* Receive signed number
 *
@@ -265,7 +897,7 @@ bool recvRetNumber(uint32_t *number, size_t timeout = NEX_TIMEOUT_RETURN) final;
 * @retval true - success.
 * @retval false - failed. 
 */
-bool recvRetNumber(int32_t *number, size_t timeout = NEX_TIMEOUT_RETURN) final;
+bool recvRetNumber(int32_t *number, size_t timeout = NEX_TIMEOUT_DEFAULT) final;
 
 /* Receive string
 *
@@ -276,7 +908,7 @@ bool recvRetNumber(int32_t *number, size_t timeout = NEX_TIMEOUT_RETURN) final;
 * @retval true - success.
 * @retval false - failed. 
 */
-bool recvRetString(String &str, size_t timeout = NEX_TIMEOUT_RETURN, bool start_flag = true) final;
+bool recvRetString(String &str, size_t timeout = NEX_TIMEOUT_DEFAULT, bool start_flag = true) final;
 
 /* Receive string
 *
@@ -288,7 +920,32 @@ bool recvRetString(String &str, size_t timeout = NEX_TIMEOUT_RETURN, bool start_
 * @retval true - success.
 * @retval false - failed. 
 */
-bool recvRetString(char *buffer, uint16_t &len, size_t timeout = NEX_TIMEOUT_RETURN, bool start_flag = true) final;
+bool recvRetString(char *buffer, uint16_t &len, size_t timeout = NEX_TIMEOUT_DEFAULT, bool start_flag = true) final;
+
+/* Receive string
+*
+* @param buffer - received value buffer
+* @param len - in buffer size / out received string length
+* @param truncated - true if string did not fit to buffer
+* @param timeout - set timeout time.
+* @param start_flag - is str start flag (0x70) expected, default falue true
+*
+* @retval true - success.
+* @retval false - failed. 
+*/
+bool recvRetString(char *buffer, uint16_t &len, bool &truncated, size_t timeout = NEX_TIMEOUT_DEFAULT, bool start_flag = true) final;
+
+/* Receive string without intermediate buffering
+*
+* @param sink - called with received string chunks as they arrive
+* @param ptr - parameter passed into sink
+* @param timeout - set timeout time.
+* @param start_flag - is str start flag (0x70) expected, default falue true
+*
+* @retval true - success.
+* @retval false - failed. 
+*/
+bool recvRetString(NexStringSinkCb sink, void *ptr, size_t timeout = NEX_TIMEOUT_DEFAULT, bool start_flag = true) final;
 
 /* Send Command to device
 *
@@ -296,6 +953,51 @@ bool recvRetString(char *buffer, uint16_t &len, size_t timeout = NEX_TIMEOUT_RET
 */
 void sendCommand(const char* cmd) final;
 
+/**
+ * Queue command to be sent from nexLoop or flushCommands
+ * 
+ * Pending assignment of literal value to the same attribute (e.g. n0.val=5) is replaced
+ * in place by the new one, so only the latest value is sent. Other commands keep their
+ * order and assignments are not moved over them. Command sent with sendCommand to an
+ * attribute with pending assignment sends the queue first, so it is not overwritten.
+ * 
+ * Command with deadline is dropped if it is not sent in time. When queue is full
+ * expired commands are dropped to make room.
+ * 
+ * @param cmd - command string
+ * @param deadline - maximum time (ms) in queue, 0 no limit
+ * @return true if queued, false if queue is full
+ */
+bool postCommand(const char* cmd, uint32_t deadline = 0) final;
+
+/**
+ * Send all queued commands and wait their replies
+ * 
+ * @return true if all commands succeeded
+ */
+bool flushCommands();
+
+/**
+ * Number of queued commands replaced by newer value of the same attribute
+ * 
+ * @return coalesced commands
+ */
+uint32_t GetCoalescedCommandCount() const;
+
+/**
+ * Number of queued commands failed when sent
+ * 
+ * @return failed commands
+ */
+uint32_t GetFailedPostedCommandCount() const;
+
+/**
+ * Number of queued commands dropped because their deadline passed
+ * 
+ * @return dropped commands
+ */
+uint32_t GetStaleCommandCount() const;
+
 /* Send Raw data to device
 *
 *  @param data - raw data buffer
@@ -311,6 +1013,12 @@ void sendRawData(const std::vector<uint8_t> &data) final;
 */
 void sendRawData(const uint8_t *buf, uint16_t len) final;
 
+/* Send Raw data to device
+*
+* @param data - raw data span, any length
+*/
+void sendRawData(NexSpan<const uint8_t> data) final;
+
 
 /* Send Raw byte to device
 *
@@ -327,7 +1035,7 @@ void sendRawByte(const uint8_t byte) final;
  * @param timeout  timeout ms
  * @return size_t read bytes can be less that size (timeout case) 
  */
-size_t readBytes(uint8_t* buffer, size_t size, size_t timeout = NEX_TIMEOUT_RETURN) final;
+size_t readBytes(uint8_t* buffer, size_t size, size_t timeout = NEX_TIMEOUT_DEFAULT) final;
 
 /* Receive command
 *
@@ -337,7 +1045,7 @@ size_t readBytes(uint8_t* buffer, size_t size, size_t timeout = NEX_TIMEOUT_RETU
 * @retval true - success.
 * @retval false - failed. 
 */
-bool recvCommand(const uint8_t command, size_t timeout = NEX_TIMEOUT_COMMAND) final;
+bool recvCommand(const uint8_t command, size_t timeout = NEX_TIMEOUT_DEFAULT) final;
 
 /*
  * Command is executed successfully. 
@@ -348,7 +1056,7 @@ bool recvCommand(const uint8_t command, size_t timeout = NEX_TIMEOUT_COMMAND) fi
  * @retval false - failed. 
  *
  */
-bool recvRetCommandFinished(size_t timeout = NEX_TIMEOUT_COMMAND) final;
+bool recvRetCommandFinished(size_t timeout = NEX_TIMEOUT_DEFAULT) final;
 
 /*
  * Transpared data mode setup successfully 
@@ -359,7 +1067,7 @@ bool recvRetCommandFinished(size_t timeout = NEX_TIMEOUT_COMMAND) final;
  * @retval false - failed. 
  *
  */
-bool RecvTransparendDataModeReady(size_t timeout = NEX_TIMEOUT_TRANSPARENT_DATA_MODE) final;
+bool RecvTransparendDataModeReady(size_t timeout = NEX_TIMEOUT_DEFAULT) final;
 
 /*
  * Transpared data mode finished 
@@ -370,7 +1078,18 @@ bool RecvTransparendDataModeReady(size_t timeout = NEX_TIMEOUT_TRANSPARENT_DATA_
  * @retval false - failed. 
  *
  */
-bool RecvTransparendDataModeFinished(size_t timeout = NEX_TIMEOUT_COMMAND) final;
+bool RecvTransparendDataModeFinished(size_t timeout = NEX_TIMEOUT_DEFAULT) final;
+
+/**
+ * receive connect reply
+ * 
+ * Replies to preceding commands are skipped, other data (garbage at wrong baud) fails immediately.
+ * 
+ * @param timeout - maximum wait time, returns as soon as comok is received
+ * 
+ * @return true if display replied comok
+ */
+bool RecvConnect(size_t timeout = NEX_TIMEOUT_DEFAULT) final;
 
 /**
  * Init Nextion connection.
@@ -379,7 +1098,63 @@ bool RecvTransparendDataModeFinished(size_t timeout = NEX_TIMEOUT_COMMAND) final
  * 
  * @return true if success, false for failure. 
  */
-bool nexInit(const uint32_t baud = NEX_SERIAL_DEFAULT_BAUD);
+bool nexInit(const uint32_t baud = 0);
+
+/**
+ * Start non-blocking Nextion initialization.
+ * 
+ * Initialization advances on every nexInitPoll or nexLoop call, queued commands
+ * are kept until initialization is done.
+ * 
+ * @param baud - baud value, see nexInit
+ */
+void nexInitBegin(const uint32_t baud = 0);
+
+/**
+ * Advance non-blocking initialization
+ * 
+ * Call blocks at most for reading already arriving reply, no fixed delays.
+ * 
+ * @return current state, NEX_INIT_DONE or NEX_INIT_FAILED when finished
+ */
+NexInitState nexInitPoll();
+
+/**
+ * State of initialization
+ * 
+ * @return current state
+ */
+NexInitState GetInitState() const;
+
+/**
+ * Select the highest baud rate with error free link
+ * 
+ * Display must be initialized. Link is stepped through higher Nextion::baudRates
+ * and at each rate known values are round tripped through sys0 variable (its value is
+ * restored). Fastest rate without errors is selected. After calibration link errors
+ * (missing replies, corrupted frames) are monitored in nexLoop and baud falls back
+ * to lower rate if errors exceed NEX_LINK_ERROR_LIMIT per NEX_LINK_MONITOR_WINDOW.
+ * 
+ * @param maxBaud - highest baud rate tried
+ * @param rounds - round trips per baud rate
+ * 
+ * @return selected baud rate
+ */
+uint32_t calibrateBaud(uint32_t maxBaud = 921600, uint8_t rounds = NEX_CALIBRATION_ROUNDS);
+
+/**
+ * Number of link errors (missing replies and corrupted frames)
+ * 
+ * @return link errors
+ */
+uint32_t GetLinkErrorCount() const;
+
+/**
+ * Number of automatic baud fall backs
+ * 
+ * @return fall backs
+ */
+uint32_t GetBaudFallbackCount() const;
 
 /**
  * current baud value
@@ -389,6 +1164,184 @@ bool nexInit(const uint32_t baud = NEX_SERIAL_DEFAULT_BAUD);
  */
 uint32_t GetCurrentBaud() final;
 
+/**
+ * Set retry policy of command class
+ * 
+ * Non idempotent commands are never retried.
+ * 
+ * @param commandClass - NEX_CMD_ASSIGNMENT or NEX_CMD_QUERY
+ * @param policy - retry policy
+ */
+void setRetryPolicy(NexCommandClass commandClass, const NexRetryPolicy &policy);
+
+/**
+ * Return code of the last request
+ * 
+ * @return NEX_RET_CMD_FINISHED_OK if expected reply was received, Nextion error code,
+ *  or NEX_RET_NO_REPLY if valid reply was not received
+ */
+uint8_t GetLastReturnCode() const;
+
+/**
+ * Number of command retries
+ * 
+ * @return retries
+ */
+uint32_t GetRetryCount() const;
+
+/**
+ * Set receive buffer size of Nextion serial port used in overflow detection
+ * 
+ * @param size - serial receive buffer size (bytes)
+ */
+void setSerialRxBufferSize(uint16_t size);
+
+/**
+ * Set instance configuration: timeouts, default baud, acknowledge mode and buffer capacities
+ * 
+ * Should be set before nexInit, acknowledge mode of initialized display is changed immediately.
+ * Buffer capacities are clamped to compile time sizes (and to currently used size).
+ * 
+ * @param config - configuration
+ */
+void setConfig(const NexInstanceConfig &config);
+
+/**
+ * Get instance configuration, capacities are clamped values
+ * 
+ * @return configuration
+ */
+const NexInstanceConfig &GetConfig() const;
+
+/**
+ * Highest number of bytes seen waiting in serial receive buffer
+ * 
+ * @return high-water mark (bytes)
+ */
+uint16_t GetRxHighWaterMark() const;
+
+/**
+ * Number of times serial receive buffer was seen full, data may have been lost
+ * 
+ * @return full buffer samples
+ */
+uint32_t GetRxFullCount() const;
+
+/**
+ * Number of frame integrity failures (missing terminator, resynchronization)
+ * 
+ * @return frame errors
+ */
+uint32_t GetFrameErrorCount() const;
+
+/**
+ * Number of frame integrity failures while data received with full receive buffer is handled,
+ * likely caused by receive buffer overflow
+ * 
+ * @return overflow suspects
+ */
+uint32_t GetRxOverflowSuspectCount() const;
+
+/**
+ * Longest time between nexLoop calls
+ * 
+ * @return interval (ms)
+ */
+uint32_t GetMaxServiceInterval() const;
+
+/**
+ * Recommended maximum time between nexLoop calls
+ * 
+ * Half of the time to fill serial receive buffer at current baud rate.
+ * 
+ * @return interval (ms)
+ */
+uint32_t GetRecommendedServiceInterval() const;
+
+/**
+ * Clear receive buffer statistics
+ */
+void resetRxStatistics();
+
+/**
+ * Arrival time of event being handled, can be called from event callbacks
+ * 
+ * @return arrival time (micros) when frame was completely read from serial port
+ */
+uint32_t GetCurrentEventTime() const;
+
+/**
+ * Number of handled events
+ * 
+ * @return events
+ */
+uint32_t GetEventCount() const;
+
+/**
+ * Average time events waited in event queue, from arrival to start of handling
+ * 
+ * @return queue delay (us)
+ */
+uint32_t GetEventQueueDelayAverage() const;
+
+/**
+ * Longest time event waited in event queue
+ * 
+ * @return queue delay (us)
+ */
+uint32_t GetEventQueueDelayMax() const;
+
+/**
+ * Longest event handling time, callbacks included
+ * 
+ * @return handling time (us)
+ */
+uint32_t GetEventHandlerTimeMax() const;
+
+/**
+ * Clear event delay statistics
+ */
+void resetEventStatistics();
+
+/**
+ * Number of late replies discarded
+ * 
+ * Late reply is reply to request which was timed out. 
+ * 
+ * @return discarded late replies
+ */
+uint32_t GetLateReplyCount() const;
+
+/**
+ * Number of unexpected replies discarded
+ * 
+ * Unexpected reply is reply which type is not expected or reply to command which reply is not read. 
+ * 
+ * @return discarded unexpected replies
+ */
+uint32_t GetUnexpectedReplyCount() const;
+
+/**
+ * Time spent waiting data from Nextion
+ * 
+ * @return wait time in microseconds (wraps around)
+ */
+uint32_t GetReceiveWaitTime() const;
+
+/**
+ * Number of unexpected data bytes skipped in resynchronization
+ * 
+ * @return skipped bytes
+ */
+uint32_t GetSkippedByteCount() const;
+
+/**
+ * Number of resynchronizations to frame terminator (0xFF 0xFF 0xFF) after unexpected data
+ * 
+ * @return resynchronizations
+ */
+uint32_t GetResyncCount() const;
+
 /**
  * Listen touch event and calling callbacks attached before.
  * 
@@ -397,6 +1350,8 @@ uint32_t GetCurrentBaud() final;
  * @param nex_listen_list - index to Nextion Components list. 
  * @return none. 
  *
+ * Queued commands (postCommand) are sent after events are handled.
+ *
  * @warning This function must be called repeatedly to response touch events
  *  from Nextion touch panel. Actually, you should place it in your loop function. 
  */
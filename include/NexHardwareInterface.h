@@ -11,6 +11,7 @@
 #pragma once
 
 #include <WString.h>
+#include "NexSpan.h"
 #ifdef ESP8266
 #include <vector>
 #endif
@@ -21,6 +22,15 @@
  * @{ 
  */
 
+/**
+ * Type of string receive sink function, called with received string chunks as they arrive
+ * 
+ * @param chunk - received chunk, null terminated
+ * @param len - chunk length
+ * @param ptr - user pointer given in receive call
+ */
+typedef void (*NexStringSinkCb)(const char *chunk, size_t len, void *ptr);
+
 /**
  * Abstract  Nextion Interface class
  *
@@ -78,12 +88,45 @@ virtual bool recvRetString(String &str, size_t timeout, bool start_flag) =0;
 */
 virtual bool recvRetString(char *buffer, uint16_t &len, size_t timeout, bool start_flag) =0;
 
+/* Receive string
+*
+* @param buffer - received value buffer
+* @param len - in buffer size / out received string length
+* @param truncated - true if string did not fit to buffer
+* @param timeout - set timeout time.
+* @param start_flag - is str start flag (0x70) expected, default falue true
+*
+* @retval true - success.
+* @retval false - failed. 
+*/
+virtual bool recvRetString(char *buffer, uint16_t &len, bool &truncated, size_t timeout, bool start_flag) =0;
+
+/* Receive string
+*
+* @param sink - called with received string chunks
+* @param ptr - parameter passed into sink
+* @param timeout - set timeout time.
+* @param start_flag - is str start flag (0x70) expected, default falue true
+*
+* @retval true - success.
+* @retval false - failed. 
+*/
+virtual bool recvRetString(NexStringSinkCb sink, void *ptr, size_t timeout, bool start_flag) =0;
+
 /* Send Command to device
 *
 * parameter command string
 */
 virtual void sendCommand(const char* cmd) =0;
 
+/* Queue command to be sent later
+*
+* parameter command string
+* parameter deadline maximum time (ms) in queue, 0 no limit
+* return true if queued
+*/
+virtual bool postCommand(const char* cmd, uint32_t deadline) =0;
+
 /* Send Raw data to device
 *
 * parameter raw data buffer
@@ -99,6 +142,12 @@ virtual void sendRawData(const std::vector<uint8_t> &data) =0;
 */
 virtual void sendRawData(const uint8_t *buf, uint16_t len) =0;
 
+/* Send Raw data to device
+*
+* @param data - raw data span, any length
+*/
+virtual void sendRawData(NexSpan<const uint8_t> data) =0;
+
 
 /* Send Raw byte to device
 *
@@ -159,6 +208,15 @@ virtual bool RecvTransparendDataModeReady(size_t timeout) =0;
  */
 virtual bool RecvTransparendDataModeFinished(size_t timeout) =0;
 
+/**
+ * receive connect reply
+ * 
+ * @param timeout - maximum wait time, returns as soon as comok is received
+ * 
+ * @return true if display replied comok
+ */
+virtual bool RecvConnect(size_t timeout) =0;
+
 /**
  * current baud value
  * 
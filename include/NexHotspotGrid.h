@@ -0,0 +1,143 @@
+/**
+ * @file NexHotspotGrid.h
+ *
+ * The definition of class NexHotspotGrid and NexVirtualHotspot. 
+ *
+ * @author Enhanced-Nextion-Library contributors 10/18/2026
+ * 
+ * @copyright 2026 Enhanced-Nextion-Library contributors
+ */
+
+#pragma once
+
+#include "NexTouch.h"
+#include "NexHardware.h"
+
+/**
+ * @addtogroup Component 
+ * @{ 
+ */
+
+/**
+ * Host defined touch area, hit tested from touch coordinates by NexHotspotGrid
+ */
+struct NexVirtualHotspot
+{
+    /**
+     * Constructor
+     *
+     * @param x - left edge
+     * @param y - top edge
+     * @param w - width
+     * @param h - height
+     * @param push - callback called with ptr when area is pressed [default:nullptr]
+     * @param pop - callback called with ptr when touch pressed on area is released [default:nullptr]
+     * @param ptr - parameter passed into callbacks [default:nullptr]
+     */
+    NexVirtualHotspot(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+        NexTouchEventCb push = nullptr, NexTouchEventCb pop = nullptr, void *ptr = nullptr)
+        :x{x}, y{y}, w{w}, h{h}, push{push}, pop{pop}, ptr{ptr}
+    {}
+
+    uint16_t x;
+    uint16_t y;
+    uint16_t w;
+    uint16_t h;
+    NexTouchEventCb push;
+    NexTouchEventCb pop;
+    void *ptr;
+
+    // grid cells covered when added, set by NexHotspotGrid::add
+    uint8_t c0{0};
+    uint8_t r0{0};
+    uint8_t c1{0};
+    uint8_t r1{0};
+};
+
+/**
+ * Virtual hotspots hit tested against touch coordinates (sendxy=1)
+ *
+ * Screen is divided to uniform grid, every cell lists regions overlapping it.
+ * Lookup checks only regions of the touched cell, cost does not grow with region count
+ * when regions are spread over the screen. Overlapping regions: last added is on top.
+ * Regions are owned by the application and must stay valid until removed.
+ * A region can be added to one grid at a time. Cells of region are resolved when it is added,
+ * after moving or resizing region remove and add it again to update cells.
+ */
+class NexHotspotGrid:public NexCoordinateListener
+{
+    NexHotspotGrid()=delete;
+
+public:
+    /**
+     * Constructor, registers grid to nextion coordinate listeners
+     *
+     * @param nextion - nextion interface
+     * @param width - screen width
+     * @param height - screen height
+     */
+    NexHotspotGrid(Nextion *nextion, uint16_t width, uint16_t height);
+
+    ~NexHotspotGrid();
+
+    /**
+     * Add region
+     *
+     * @param hotspot - region
+     * @return true if success, false if region is already added or there is not enough
+     * free cell links (NEX_HOTSPOT_LINKS)
+     */
+    bool add(NexVirtualHotspot *hotspot);
+
+    /**
+     * Remove region from cells it was added to, region geometry may have changed since
+     *
+     * @param hotspot - region
+     * @return true if removed, false if region was not added
+     */
+    bool remove(NexVirtualHotspot *hotspot);
+
+    /**
+     * Remove all regions
+     */
+    void clear();
+
+    /**
+     * Find topmost region containing coordinate
+     *
+     * @param x - x coordinate
+     * @param y - y coordinate
+     * @return region or nullptr
+     */
+    NexVirtualHotspot *hitTest(uint16_t x, uint16_t y) const;
+
+    /**
+     * Get number of free cell links
+     */
+    uint16_t GetFreeLinkCount() const;
+
+    void touchCoordinate(uint16_t x, uint16_t y, uint8_t event, uint32_t time) override;
+
+private:
+    struct nexHotspotLink
+    {
+        NexVirtualHotspot *hotspot;
+        uint16_t next;
+    };
+
+    bool Cells(const NexVirtualHotspot *hotspot, uint8_t &c0, uint8_t &r0, uint8_t &c1, uint8_t &r1) const;
+
+    Nextion *m_nextion;
+    uint16_t m_cellWidth;
+    uint16_t m_cellHeight;
+    uint16_t m_cells[NEX_HOTSPOT_GRID_ROWS * NEX_HOTSPOT_GRID_COLUMNS];
+    nexHotspotLink m_links[NEX_HOTSPOT_LINKS];
+    uint16_t m_free;
+    uint16_t m_freeCount;
+    NexVirtualHotspot *m_pressed{nullptr};
+    bool m_down{false};
+};
+
+/**
+ * @}
+ */
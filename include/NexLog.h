@@ -0,0 +1,127 @@
+/**
+ * @file NexLog.h
+ *
+ * Binary structured logging to RAM ring buffer.
+ * 
+ * Log records are stored as event id, time stamp and one numeric argument,
+ * text is formatted on the host when dumped buffer is decoded
+ * with tools/nexlog_decode.py. Logging levels above NEX_LOG_LEVEL
+ * are compiled out.
+ *
+ * @author Enhanced-Nextion-Library contributors 10/18/2026
+ * 
+ * @copyright 2026 Enhanced-Nextion-Library contributors
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include "NexConfig.h"
+
+/**
+ * @addtogroup CoreAPI 
+ * @{ 
+ */
+
+#define NEX_LOG_LEVEL_OFF     0
+#define NEX_LOG_LEVEL_ERROR   1
+#define NEX_LOG_LEVEL_WARNING 2
+#define NEX_LOG_LEVEL_INFO    3
+#define NEX_LOG_LEVEL_DEBUG   4
+
+/**
+ * Log events
+ * 
+ * Comment after each event is the format string used by host decoder,
+ * %d is replaced by the record argument. Append new events to the end.
+ */
+enum NexLogEvent : uint8_t
+{
+    NEX_LOG_EVENT_FRAME_TOO_LONG,       // custom event frame too long, header %d
+    NEX_LOG_RECV_NUMBER,                // recvRetNumber: %d
+    NEX_LOG_RECV_NUMBER_ERR,            // recvRetNumber err, return code %d
+    NEX_LOG_RECV_STRING,                // recvRetString length %d
+    NEX_LOG_REQUEST_ABANDONED,          // request abandoned seq %d
+    NEX_LOG_LATE_REPLY,                 // late reply discarded seq %d
+    NEX_LOG_UNEXPECTED_REPLY,           // unexpected reply discarded, header %d
+    NEX_LOG_RESYNC,                     // unexpected data skipped %d bytes
+    NEX_LOG_RETRY,                      // retry command seq %d
+    NEX_LOG_RECV_COMMAND_TIMEOUT,       // recv command timeout, expected %d
+    NEX_LOG_RECV_COMMAND_ERR,           // recv command err value %d
+    NEX_LOG_COMMAND_FINISHED,           // recvRetCommandFinished ok
+    NEX_LOG_COMMAND_FINISHED_ERR,       // recvRetCommandFinished err, return code %d
+    NEX_LOG_STALE_COMMAND,              // stale command dropped, length %d
+    NEX_LOG_SEND_COMMAND,               // send command seq %d
+    NEX_LOG_EVENT                       // event frame header %d
+};
+
+/**
+ * Binary log ring buffer
+ * 
+ * Record is 9 bytes: event id, micros() and argument (little endian).
+ * When buffer is full oldest record is overwritten.
+ */
+class NexLog
+{
+public:
+    /**
+     * Store log record
+     * 
+     * @param event - log event
+     * @param arg - event argument
+     */
+    static void write(NexLogEvent event, int32_t arg = 0);
+
+    /**
+     * Write log buffer to output in binary and clear it
+     * 
+     * Output starts with header: "NXL", format version, record count (uint16),
+     * overwritten record count (uint32) followed by records oldest first.
+     * 
+     * @param out - output e.g. debug serial
+     * @return number of records written
+     */
+    static uint16_t dump(Print &out);
+
+    /**
+     * Number of records overwritten before dump
+     * 
+     * @return overwritten records
+     */
+    static uint32_t GetOverwrittenCount();
+};
+
+#if NEX_LOG_LEVEL <= NEX_LOG_LEVEL_OFF
+// logging is compiled out, nothing is stored
+inline void NexLog::write(NexLogEvent, int32_t) {}
+inline uint16_t NexLog::dump(Print &) {return 0;}
+inline uint32_t NexLog::GetOverwrittenCount() {return 0;}
+#endif
+
+#if NEX_LOG_LEVEL >= NEX_LOG_LEVEL_ERROR
+#define NEX_LOG_ERROR(event, arg)   NexLog::write(event, arg)
+#else
+#define NEX_LOG_ERROR(event, arg)   do{}while(0)
+#endif
+
+#if NEX_LOG_LEVEL >= NEX_LOG_LEVEL_WARNING
+#define NEX_LOG_WARNING(event, arg) NexLog::write(event, arg)
+#else
+#define NEX_LOG_WARNING(event, arg) do{}while(0)
+#endif
+
+#if NEX_LOG_LEVEL >= NEX_LOG_LEVEL_INFO
+#define NEX_LOG_INFO(event, arg)    NexLog::write(event, arg)
+#else
+#define NEX_LOG_INFO(event, arg)    do{}while(0)
+#endif
+
+#if NEX_LOG_LEVEL >= NEX_LOG_LEVEL_DEBUG
+#define NEX_LOG_DEBUG(event, arg)   NexLog::write(event, arg)
+#else
+#define NEX_LOG_DEBUG(event, arg)   do{}while(0)
+#endif
+
+/**
+ * @}
+ */
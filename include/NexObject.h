@@ -126,10 +126,20 @@ protected: /* methods */
     /*
     * Get component global name
     * 
+    * With NEX_SHORTEST_ADDRESSING shorter of name (page0.n0) and id (p[0].b[3])
+    * forms is used, local components b[3] or n0.
+    * 
     * @param gName - object page name
     */
     void getObjGlobalPageName(String &gName);
 
+    /*
+    * Get component name or id on current page, used with vis and ref commands
+    * 
+    * @param lName - object name or id
+    */
+    void getObjLocalName(String &lName);
+
 private: /* data */ 
     const uint8_t _pid; /* Page ID */
     const uint8_t _cid; /* Component ID */
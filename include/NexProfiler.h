@@ -0,0 +1,138 @@
+/**
+ * @file NexProfiler.h
+ *
+ * Blocking time profiler of component calls.
+ * 
+ * Time spent waiting in receive calls made by components (readBytes, recvRetNumber,
+ * recvRetString, recvRetCommandFinished, recvCommand) is summed per call site.
+ * Call site is the head of the command sent before the receive call, up to '=', ','
+ * or '"', e.g. "get page2.t5.txt" for NexText::getText or "page2.n0.val=" for
+ * NexNumber::setValue, which identifies both component and operation.
+ * 
+ * Enabled by defining NEX_ENABLE_PROFILER in NexConfig.h.
+ *
+ * @author Enhanced-Nextion-Library contributors 10/18/2026
+ * 
+ * @copyright 2026 Enhanced-Nextion-Library contributors
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include "NexConfig.h"
+
+#ifdef NEX_ENABLE_PROFILER
+
+/**
+ * @addtogroup CoreAPI 
+ * @{ 
+ */
+
+/**
+ * Aggregated blocking time of one call site
+ */
+struct NexProfileEntry
+{
+    char site[NEX_PROFILER_SITE_SIZE];  // command head
+    uint32_t count;                     // number of blocking calls
+    uint32_t total;                     // total blocking time (us)
+    uint32_t max;                       // longest blocking call (us)
+};
+
+/**
+ * Call site profiler
+ */
+class NexProfiler
+{
+public:
+    /**
+     * Set current call site from sent command
+     * 
+     * @param cmd - command string
+     */
+    static void setSite(const char *cmd);
+
+    /**
+     * Name id addressed component of next call site
+     * 
+     * Site of next sent command shows page.name instead of the id form.
+     * 
+     * @param id - id form used in command (p[0].b[3], b[3] or 3)
+     * @param page - page name, nullptr for local component
+     * @param name - component name
+     */
+    static void setAlias(const char *id, const char *page, const char *name);
+
+    /**
+     * Add blocking time to current call site
+     * 
+     * @param us - blocking time (us)
+     */
+    static void record(uint32_t us);
+
+    /**
+     * Number of call sites recorded
+     * 
+     * @return entries
+     */
+    static uint8_t GetEntryCount();
+
+    /**
+     * Get call site entry
+     * 
+     * @param index - entry index, 0 ... GetEntryCount()-1
+     * @return entry
+     */
+    static const NexProfileEntry& GetEntry(uint8_t index);
+
+    /**
+     * Number of calls not recorded because call site table was full
+     * 
+     * @return dropped calls
+     */
+    static uint32_t GetDroppedCount();
+
+    /**
+     * Print call site table: site, count, total us, max us
+     * 
+     * @param out - output e.g. Serial
+     */
+    static void report(Print &out);
+
+    /**
+     * Clear all entries
+     */
+    static void reset();
+};
+
+/**
+ * Measures blocking time of the enclosing scope
+ */
+class NexProfileScope
+{
+public:
+    NexProfileScope():m_start{micros()}
+    {}
+    ~NexProfileScope()
+    {
+        NexProfiler::record(micros() - m_start);
+    }
+private:
+    uint32_t m_start;
+};
+
+#define NEX_PROFILE_SITE(cmd) NexProfiler::setSite(cmd)
+#define NEX_PROFILE_ALIAS(id, page, name) NexProfiler::setAlias(id, page, name)
+#define NEX_PROFILE_SCOPE() NexProfileScope _nex_profile_scope
+
+/**
+ * @}
+ */
+
+#else
+
+#define NEX_PROFILE_SITE(cmd) do{}while(0)
+#define NEX_PROFILE_ALIAS(id, page, name) do{}while(0)
+#define NEX_PROFILE_SCOPE() do{}while(0)
+
+#endif
@@ -60,6 +60,16 @@ public: /* methods */
      */
     bool setValue(uint32_t number);
 
+    /**
+     * Queue value to be sent from nexLoop, pending value is replaced
+     *
+     * @param number - the value of progress bar.
+     * @param deadline - maximum time (ms) in queue, stale value is dropped, 0 no limit
+     *
+     * @return true if queued, false if queue is full
+     */
+    bool postValue(uint32_t number, uint32_t deadline = 0);
+
     /**
      * Set the value of background image (bpic)
      *
@@ -0,0 +1,189 @@
+/**
+ * @file NexRegistry.h
+ *
+ * The definition of class NexRegistry. 
+ *
+ * @author Enhanced-Nextion-Library contributors 10/18/2026
+ * 
+ * @copyright 2026 Enhanced-Nextion-Library contributors
+ */
+
+#pragma once
+
+#include "NexConfig.h"
+
+#ifdef NEX_ENABLE_DISCOVERY
+
+#include <Arduino.h>
+#include "NextionIf.h"
+
+class Nextion;
+
+/**
+ * @addtogroup CoreAPI 
+ * @{ 
+ */
+
+/**
+ * Nextion component types reported by type attribute
+ */
+enum NexComponentType : uint8_t
+{
+    NEX_TYPE_WAVEFORM       = 0,
+    NEX_TYPE_SLIDER         = 1,
+    NEX_TYPE_TIMER          = 51,
+    NEX_TYPE_VARIABLE       = 52,
+    NEX_TYPE_DUAL_STATE     = 53,
+    NEX_TYPE_NUMBER         = 54,
+    NEX_TYPE_SCROLLTEXT     = 55,
+    NEX_TYPE_CHECKBOX       = 56,
+    NEX_TYPE_RADIO          = 57,
+    NEX_TYPE_QRCODE         = 58,
+    NEX_TYPE_XFLOAT         = 59,
+    NEX_TYPE_BUTTON         = 98,
+    NEX_TYPE_PROGRESSBAR    = 106,
+    NEX_TYPE_HOTSPOT        = 109,
+    NEX_TYPE_PICTURE        = 112,
+    NEX_TYPE_CROP           = 113,
+    NEX_TYPE_TEXT           = 116,
+    NEX_TYPE_PAGE           = 121,
+    NEX_TYPE_GAUGE          = 122
+};
+
+/**
+ * Discovered component
+ */
+struct NexComponentInfo
+{
+    uint8_t pid;
+    uint8_t cid;
+    uint8_t type;   // NexComponentType
+    int16_t x;      // geometry, 0 if attribute is not readable
+    int16_t y;
+    int16_t w;
+    int16_t h;
+};
+
+/**
+ * Registry of components discovered from the display
+ * 
+ * Components of a page are enumerated with get queries of p[pid].b[cid] type and
+ * geometry attributes, so the page must be current page or its components global.
+ * Registry can be cached to EEPROM keyed by TFT fingerprint, discovery needs to be run
+ * only when TFT changes. Component names are not readable from the display, registry
+ * is indexed by ids and types.
+ */
+class NexRegistry:public NextionIf
+{
+    NexRegistry()=delete;
+
+public: /* methods */
+
+    /**
+     * Constructor. 
+     * 
+     * @param nextion - nextion iterface
+     */
+    NexRegistry(Nextion *nextion);
+
+    /**
+     * Fingerprint from numeric attribute, e.g. HMI revision number kept in a global variable
+     * 
+     * @param query - get command e.g. "get main.hmiRev.val"
+     * @param fingerprint - resulting fingerprint
+     * 
+     * @return true if success, false for failure
+     */
+    bool queryFingerprint(const char *query, uint32_t &fingerprint);
+
+    /**
+     * Fingerprint from component types of a page, one query per component
+     * 
+     * @param pid - page id
+     * @param fingerprint - resulting fingerprint
+     * 
+     * @return true if success, false for failure
+     */
+    bool typeFingerprint(uint8_t pid, uint32_t &fingerprint);
+
+    /**
+     * Load registry from EEPROM cache
+     * 
+     * @param fingerprint - TFT fingerprint
+     * 
+     * @return true if cache was valid for the fingerprint, false registry is cleared
+     */
+    bool load(uint32_t fingerprint);
+
+    /**
+     * Save registry to EEPROM cache
+     */
+    void save();
+
+    /**
+     * Enumerate components of a page and add them to registry
+     * 
+     * Previous entries of the page are replaced.
+     * 
+     * @param pid - page id
+     * 
+     * @return number of components found, including page itself
+     */
+    uint8_t discoverPage(uint8_t pid);
+
+    /**
+     * Find component
+     * 
+     * @param pid - page id
+     * @param cid - component id
+     * 
+     * @return component info or nullptr if not found
+     */
+    const NexComponentInfo* find(uint8_t pid, uint8_t cid) const;
+
+    /**
+     * Find component by type
+     * 
+     * @param pid - page id
+     * @param type - component type
+     * @param index - index of component among components of the type on the page
+     * 
+     * @return component info or nullptr if not found
+     */
+    const NexComponentInfo* findByType(uint8_t pid, uint8_t type, uint8_t index = 0) const;
+
+    /**
+     * Number of components in registry
+     */
+    uint8_t GetCount() const;
+
+    /**
+     * Get component info
+     * 
+     * @param index - 0 ... GetCount()-1
+     */
+    const NexComponentInfo& GetInfo(uint8_t index) const;
+
+private: /* methods */
+
+    /**
+     * Query attribute of component
+     * 
+     * @param pid - page id
+     * @param cid - component id
+     * @param attribute - attribute name
+     * @param value - received value
+     * 
+     * @return true if success, false for failure
+     */
+    bool QueryAttribute(uint8_t pid, uint8_t cid, const char *attribute, int32_t &value);
+
+private: /* data */
+    NexComponentInfo m_components[NEX_REGISTRY_SIZE];
+    uint8_t m_count{0};
+    uint32_t m_fingerprint{0};
+};
+/**
+ * @}
+ */
+#endif
@@ -0,0 +1,148 @@
+/**
+ * @file NexSpan.h
+ *
+ * The definition of class NexSpan, non owning view to contiguous buffer for bulk data APIs. 
+ *
+ * @author Enhanced-Nextion-Library contributors 10/18/2026
+ * 
+ * @copyright 2026 Enhanced-Nextion-Library contributors
+ */
+
+#pragma once
+
+#include <stddef.h>
+
+/**
+ * @addtogroup CoreAPI
+ * @{
+ */
+
+/**
+ * View to contiguous buffer: pointer and length.
+ *
+ * Can be constructed from pointer and length, array or any container having
+ * data() and size() members (std::vector, std::array, String like buffers...),
+ * data is not copied. Use NexSpan<const T> for read only data.
+ *
+ * Ring buffer content is passed as two spans, the part before and after wrap around.
+ *
+ * @tparam T - element type
+ */
+template<typename T>
+class NexSpan
+{
+public:
+    /**
+     * Empty span
+     */
+    NexSpan():m_data{nullptr},m_size{0}
+    {}
+
+    /**
+     * Span from pointer and length
+     *
+     * @param data - pointer to first element
+     * @param size - number of elements
+     */
+    NexSpan(T *data, size_t size):m_data{data},m_size{size}
+    {}
+
+    /**
+     * Span over array
+     *
+     * @param array - array
+     */
+    template<typename U, size_t N>
+    NexSpan(U (&array)[N]):m_data{array},m_size{N}
+    {}
+
+    /**
+     * Span over container having data() and size()
+     *
+     * @param container - container, must outlive the span
+     */
+    template<typename C, typename = decltype(((C*)nullptr)->data())>
+    NexSpan(C &container):m_data{container.data()},m_size{(size_t)container.size()}
+    {}
+
+    /**
+     * Span over const container having data() and size()
+     *
+     * @param container - container, must outlive the span
+     */
+    template<typename C, typename = decltype(((const C*)nullptr)->data())>
+    NexSpan(const C &container):m_data{container.data()},m_size{(size_t)container.size()}
+    {}
+
+    T *data() const {return m_data;}
+    size_t size() const {return m_size;}
+    bool empty() const {return m_size == 0;}
+    T *begin() const {return m_data;}
+    T *end() const {return m_data + m_size;}
+    T &operator[](size_t i) const {return m_data[i];}
+
+    /**
+     * Part of the span
+     *
+     * @param offset - first element of the part
+     * @param count - maximum number of elements, clamped to span end
+     * @return span of the part
+     */
+    NexSpan subspan(size_t offset, size_t count) const
+    {
+        if(offset > m_size)
+        {
+            offset = m_size;
+        }
+        if(count > m_size - offset)
+        {
+            count = m_size - offset;
+        }
+        return NexSpan(m_data + offset, count);
+    }
+
+private:
+    T *m_data;
+    size_t m_size;
+};
+
+/**
+ * Make span from pointer and length, element type is deduced
+ *
+ * @param data - pointer to first element
+ * @param size - number of elements
+ * @return span
+ */
+template<typename T>
+inline NexSpan<T> nexSpan(T *data, size_t size)
+{
+    return NexSpan<T>(data, size);
+}
+
+/**
+ * Make span from array, element type is deduced
+ *
+ * @param array - array
+ * @return span
+ */
+template<typename T, size_t N>
+inline NexSpan<T> nexSpan(T (&array)[N])
+{
+    return NexSpan<T>(array);
+}
+
+/**
+ * Make read only span from container having data() and size(), element type is deduced
+ *
+ * @param container - container
+ * @return span
+ */
+template<typename C>
+inline auto nexSpan(const C &container) -> NexSpan<typename C::value_type const>
+{
+    return NexSpan<typename C::value_type const>(container.data(), container.size());
+}
+
+/**
+ * @}
+ */
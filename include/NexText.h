@@ -65,6 +65,29 @@ public: /* methods */
      * @retval false - failed.
      */
     bool getText(char *buffer, uint16_t &len);
+
+    /**
+     * Get text attribute of component.
+     *
+     * @param buffer - buffer storing text returned. 
+     * @param len - in buffer len / out saved string len excluding null char.  
+     * @param truncated - true if text did not fit to buffer. 
+     * 
+     * @retval true - success. 
+     * @retval false - failed.
+     */
+    bool getText(char *buffer, uint16_t &len, bool &truncated);
+
+    /**
+     * Get text attribute of component, text is passed to sink in chunks as it is received.
+     *
+     * @param sink - called with received text chunks. 
+     * @param ptr - parameter passed into sink[default:nullptr]. 
+     * 
+     * @retval true - success. 
+     * @retval false - failed.
+     */
+    bool getText(NexStringSinkCb sink, void *ptr = nullptr);
     
     /**
      * Set text attribute of component.
@@ -73,6 +96,15 @@ public: /* methods */
      * @return true if success, false for failure. 
      */
     bool setText(const char *buffer);    
+
+    /**
+     * Queue text to be sent from nexLoop, pending text is replaced
+     *
+     * @param buffer - text buffer terminated with '\0'. 
+     * @param deadline - maximum time (ms) in queue, stale value is dropped, 0 no limit
+     * @return true if queued, false if queue is full
+     */
+    bool postText(const char *buffer, uint32_t deadline = 0);
 	
     /**
      * Append text to text attribute of component.
@@ -0,0 +1,159 @@
+/**
+ * @file NexTimerWheel.h
+ *
+ * The definition of class NexTimerWheel and NexWheelTimer. 
+ *
+ * @author Enhanced-Nextion-Library contributors 10/18/2026
+ * 
+ * @copyright 2026 Enhanced-Nextion-Library contributors
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include "NexConfig.h"
+
+#define NEX_TIMER_WHEEL_LEVELS 3
+#define NEX_TIMER_WHEEL_SLOTS (1u << NEX_TIMER_WHEEL_SLOT_BITS)
+
+/**
+ * @addtogroup CoreAPI 
+ * @{ 
+ */
+
+/**
+ * Type of host timer callback function
+ *
+ * @param ptr - user pointer given in timer constructor
+ */
+typedef void (*NexWheelTimerCb)(void *ptr);
+
+/**
+ * Host timer, node of NexTimerWheel
+ *
+ * Timer is owned by the application and must stay valid while it is active.
+ */
+class NexWheelTimer
+{
+public:
+    /**
+     * Constructor
+     *
+     * @param callback - called from NexTimerWheel::poll when timer expires
+     * @param ptr - parameter passed into callback[default:nullptr]
+     */
+    NexWheelTimer(NexWheelTimerCb callback, void *ptr = nullptr);
+
+    /**
+     * Is timer started and not yet expired (periodic timer until stopped)
+     */
+    bool isActive() const;
+
+private:
+    friend class NexTimerWheel;
+    NexWheelTimerCb m_cb;
+    void *m_ptr;
+    uint32_t m_expires{0};          // tick
+    uint32_t m_period{0};           // ticks, 0 one shot
+    NexWheelTimer *m_next{nullptr};
+    NexWheelTimer **m_pprev{nullptr};   // link pointing to this, nullptr when not active
+};
+
+/**
+ * Hierarchical timer wheel for host side periodic and one shot work
+ *
+ * Timers are kept in NEX_TIMER_WHEEL_LEVELS levels of NEX_TIMER_WHEEL_SLOTS slots,
+ * start, stop and expiry are O(1) and no heap is used. Wheel is advanced by poll,
+ * which Nextion::nexLoop calls when the wheel is set with Nextion::setTimerWheel.
+ */
+class NexTimerWheel
+{
+public:
+    /**
+     * Constructor
+     *
+     * @param tick - timer resolution (ms)
+     */
+    NexTimerWheel(uint16_t tick = NEX_TIMER_WHEEL_TICK);
+
+    /**
+     * Start or restart timer
+     *
+     * @param timer - timer
+     * @param delay - time to first expiry (ms), rounded up to ticks
+     * @param period - period of periodic timer (ms), 0 one shot timer
+     */
+    void start(NexWheelTimer &timer, uint32_t delay, uint32_t period = 0);
+
+    /**
+     * Stop timer
+     *
+     * @param timer - timer
+     */
+    void stop(NexWheelTimer &timer);
+
+    /**
+     * Set time budget of expired timer callbacks per poll,
+     * timers not run within the budget are run on next poll
+     *
+     * @param budget - time budget (us), 0 no limit
+     */
+    void setBudget(uint32_t budget);
+
+    /**
+     * Advance wheel to current time and call expired timer callbacks
+     */
+    void poll();
+
+    /**
+     * Number of expired timer callbacks called
+     */
+    uint32_t GetExpiredCount() const;
+
+    /**
+     * Longest delay from timer expiry time to callback call (ms)
+     */
+    uint32_t GetMaxJitter() const;
+
+    /**
+     * Average delay from timer expiry time to callback call (ms)
+     */
+    uint32_t GetAverageJitter() const;
+
+    /**
+     * Number of polls which left expired timers to next poll because of time budget
+     */
+    uint32_t GetDeferredCount() const;
+
+    /**
+     * Clear jitter statistics
+     */
+    void resetStatistics();
+
+private:
+    void Link(NexWheelTimer **head, NexWheelTimer &timer);
+    void Unlink(NexWheelTimer &timer);
+    void Insert(NexWheelTimer &timer);
+    void Cascade(uint8_t level);
+    void Advance(uint32_t ticks);
+    void Update();
+
+    NexWheelTimer *m_slots[NEX_TIMER_WHEEL_LEVELS][NEX_TIMER_WHEEL_SLOTS];
+    NexWheelTimer *m_ready{nullptr};    // expired, callback not yet called
+    NexWheelTimer **m_readyTail;
+    uint16_t m_tick;
+    uint16_t m_count{0};                // active timers in slots
+    uint32_t m_current{0};              // current tick
+    uint32_t m_lastTime;                // time of last update (ms)
+    uint16_t m_remainder{0};            // time from start of current tick to last update (ms)
+    uint32_t m_budget{0};
+    uint32_t m_expired{0};
+    uint32_t m_jitterMax{0};
+    uint32_t m_jitterSum{0};
+    uint32_t m_jitterSumCount{0};
+    uint32_t m_deferred{0};
+};
+
+/**
+ * @}
+ */
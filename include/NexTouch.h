@@ -46,6 +46,31 @@ class Nextion;
  */
 typedef void (*NexTouchEventCb)(void *ptr);
 
+/**
+ * Type of callback funciton when panel reports changed component value. 
+ * 
+ * @param value - new value of the component. 
+ * @param ptr - user pointer for any purpose. Commonly, it is a pointer to a object. 
+ * @return none. 
+ */
+typedef void (*NexValueChangeCb)(int32_t value, void *ptr);
+
+/**
+ * Listener slot in pool shared by all components
+ */
+struct nexListener
+{
+    union
+    {
+        NexTouchEventCb touch;
+        NexValueChangeCb value;
+    } callback;
+    void *ptr;
+    uint8_t event;  // NEX_EVENT_PUSH, NEX_EVENT_POP or value change
+    uint8_t next;   // next listener of the component
+    bool used;
+};
+
 /**
  * Father class of the components with touch events.  
  *
@@ -59,6 +84,7 @@ class NexTouch: public NexObject
 
 public: /* static methods */    
     static void iterate(NexTouch **list, uint8_t pid, uint8_t cid, uint8_t event);
+    static void iterateValueChange(NexTouch **list, uint8_t pid, uint8_t cid, int32_t value);
 
 public: /* methods */
 
@@ -67,6 +93,11 @@ public: /* methods */
      */
     NexTouch(Nextion *nextion, uint8_t pid, uint8_t cid, const char *name, const NexObject* page=nullptr);
 
+    /**
+     * Destructor, releases listeners of the component
+     */
+    ~NexTouch();
+
     /**
      * Attach an callback function of push touch event. 
      *
@@ -102,16 +133,135 @@ public: /* methods */
      * @return none. 
      */
     void detachPop(void);
-    
+
+    /**
+     * Attach an callback function of value change event. 
+     *
+     * Panel reports value changes with value change frame (see NEX_RET_VALUE_CHANGE_HEAD),
+     * HMI code for the frame can be get with getValueChangeSnippet. 
+     * Component must be in the nexLoop listen list.
+     *
+     * @param change - callback called with new value and ptr when reported value changes. 
+     * @param ptr - parameter passed into change[default:nullptr]. 
+     * @return none. 
+     *
+     * @note If calling this method multiply, the last call is valid. 
+     */
+    void attachValueChange(NexValueChangeCb change, void *ptr = nullptr);
+
+    /**
+     * Detach an callback function. 
+     * 
+     * @return none. 
+     */
+    void detachValueChange(void);
+
+    /**
+     * Add listener of push touch event.
+     * 
+     * Listeners are called in addition to the attached callback, in order they were added.
+     * Listeners of all components share a fixed size pool (NEX_MAX_LISTENERS).
+     * Listeners may be added and removed in listener callback.
+     *
+     * @param push - callback called with ptr when a push touch event occurs. 
+     * @param ptr - parameter passed into push[default:nullptr]. 
+     * @return true if added, false if listener pool is full. 
+     */
+    bool addPushListener(NexTouchEventCb push, void *ptr = nullptr);
+
+    /**
+     * Add listener of pop touch event.
+     *
+     * @param pop - callback called with ptr when a pop touch event occurs. 
+     * @param ptr - parameter passed into pop[default:nullptr]. 
+     * @return true if added, false if listener pool is full. 
+     */
+    bool addPopListener(NexTouchEventCb pop, void *ptr = nullptr);
+
+    /**
+     * Add listener of value change event.
+     *
+     * @param change - callback called with new value and ptr when reported value changes. 
+     * @param ptr - parameter passed into change[default:nullptr]. 
+     * @return true if added, false if listener pool is full. 
+     */
+    bool addValueChangeListener(NexValueChangeCb change, void *ptr = nullptr);
+
+    /**
+     * Remove push or pop listener.
+     *
+     * @param callback - listener callback
+     * @param ptr - parameter given when listener was added
+     * @return true if removed, false if not found. 
+     */
+    bool removeListener(NexTouchEventCb callback, void *ptr = nullptr);
+
+    /**
+     * Remove value change listener.
+     *
+     * @param callback - listener callback
+     * @param ptr - parameter given when listener was added
+     * @return true if removed, false if not found. 
+     */
+    bool removeListener(NexValueChangeCb callback, void *ptr = nullptr);
+
+    /**
+     * Get latest value reported by panel, or read / set by get/setValue. 
+     * 
+     * @param value - latest known value
+     * @return true if value is known, false if value is not yet received. 
+     */
+    bool getCachedValue(int32_t &value) const;
+
+    /**
+     * Get latest value of unsigned val attribute (number, slider, checkbox) without round trip.
+     *
+     * @param number - an output parameter to save the cached value.  
+     *
+     * @return true if value is known, false if value is not yet received
+     */
+    bool getCachedValue(uint32_t *number) const;
+
+    /**
+     * Get HMI code which reports component value changes to the library. 
+     * 
+     * Add code e.g. to component Touch Release Event (slider also Touch Move Event).
+     * 
+     * @param snippet - HMI code is appended to snippet
+     * @param attribute - reported attribute [default:"val"]
+     * @return none. 
+     */
+    void getValueChangeSnippet(String &snippet, const char *attribute = "val");
+
+protected: /* methods */
+
+    /*
+     * Update cached value without calling value change callback.
+     *
+     * @param value - value to cache
+     */
+    void setCachedValue(int32_t value);
+
 private: /* methods */ 
     void push(void);
     void pop(void);
+    void valueChanged(int32_t value);
+    bool addListener(uint8_t event, nexListener &listener);
+    void unlinkListener(uint8_t *link);
+    void callListeners(uint8_t event, int32_t value = 0);
+    void sweepListeners(void);
     
 private: /* data */ 
     NexTouchEventCb __cb_push;
     void *__cbpush_ptr;
     NexTouchEventCb __cb_pop;
     void *__cbpop_ptr;
+    NexValueChangeCb __cb_value;
+    void *__cbvalue_ptr;
+    int32_t __cached_value;
+    bool __cached_value_valid;
+    uint8_t __listeners;
+    uint8_t __dispatching;  // nesting depth of listener calls
 };
 
 /**
@@ -30,6 +30,7 @@
 #endif
 #include <WString.h>
 #include "NextionIf.h"
+#include "NexSpan.h"
 
 
 class Nextion;
@@ -73,6 +74,15 @@ public: /* methods */
      * @return true if success, false for failure. 
      */
     bool upload(File  &tftFile);
+
+    /**
+     * start download from memory, e.g. flash mapped tft image.
+     * 
+     * @param tft - tft file content.
+     *
+     * @return true if success, false for failure. 
+     */
+    bool upload(NexSpan<const uint8_t> tft);
 private: /* methods */
     
     /**
@@ -87,11 +97,11 @@ private: /* methods */
     /**
      * Initialize upload.
      * 
-     * @param tftFile - tft file.
+     * @param size - tft file size.
      *
      * @return true if success, false for failure. 
      */
-    bool InitUpload(File  &tftFile);
+    bool InitUpload(uint32_t size);
     
     /**
      * start dowload tft file to nextion. 
@@ -101,6 +111,15 @@ private: /* methods */
      * @return true if success, false for failure.  
      */
     bool _downloadTftFile(File  &tftFile);
+
+    /**
+     * start dowload tft file content to nextion. 
+     * 
+     * @param tft - tft file content.
+     * 
+     * @return true if success, false for failure.  
+     */
+    bool _downloadTftData(NexSpan<const uint8_t> tft);
 };
 /**
  * @}
@@ -75,6 +75,15 @@ public: /* methods */
      * @return true if success, false for failure. 
      */
     bool setText(const char *buffer);    
+
+    /**
+     * Queue text to be sent from nexLoop, pending text is replaced
+     *
+     * @param buffer - text buffer terminated with '\0'. 
+     * @param deadline - maximum time (ms) in queue, stale value is dropped, 0 no limit
+     * @return true if queued, false if queue is full
+     */
+    bool postText(const char *buffer, uint32_t deadline = 0);
 	
     /**
      * Get val attribute of component
@@ -91,6 +100,18 @@ public: /* methods */
      * @return true if success, false for failure
      */
     bool setValue(int32_t number);
+
+    /**
+     * Queue value to be sent from nexLoop, pending value is replaced
+     *
+     * setValue after postValue sends the pending value first, the value of setValue is kept.
+     *
+     * @param number - the value.
+     * @param deadline - maximum time (ms) in queue, stale value is dropped, 0 no limit
+     *
+     * @return true if queued, false if queue is full
+     */
+    bool postValue(int32_t number, uint32_t deadline = 0);
 };
 /**
  * @}
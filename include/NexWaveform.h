@@ -25,6 +25,7 @@
 #endif
 
 #include "NexTouch.h"
+#include "NexSpan.h"
 
 class Nextion;
 class NexObject;
@@ -91,27 +92,30 @@ public: /* methods */
         return true;
     }
 
-#ifdef ESP8266
     /**
      * Add values to show. 
      *
+     * Values are sent in transparent data mode, max 124 values per addt command.
+     * 
      * @tparam T - typename (numeeric tupes supported)
      * @param ch - channel of waveform(0-3). 
-     * @param values - the values of waveform (values are scaled to nextion resolution 0-255 based on Min / Max component hight).  
+     * @param values - span of the values of waveform (values are scaled to nextion resolution 0-255 based on Min / Max component hight). 
      *
-     * @return true if success, false for failure
+     * @retval true - success false - failed. 
      */
     template<typename T>
-    bool addValues(uint8_t ch, std::vector<T> &values)
+    bool addValues(uint8_t ch, NexSpan<T> values)
     {
-        // compile time data type check  
+        #ifdef ESP8266
+        // compile time data type check 
         static_assert(std::is_arithmetic<T>::value, "Not numeric type");
+        #endif
 
         bool ret=true;
  
-        for(uint16_t offset{0}; offset < values.size() && ret;)
+        for(size_t offset{0}; offset < values.size() && ret;)
         {
-            uint32_t sendBytes{values.size()-offset};
+            size_t sendBytes{values.size()-offset};
             if(sendBytes>124)
             {
                 sendBytes=124;
@@ -136,7 +140,7 @@ public: /* methods */
                 ret=false;
                 break;
             }
-            for(uint16_t i{0}; i<sendBytes; ++i)
+            for(size_t i{0}; i<sendBytes; ++i)
             {
                 sendRawByte(ScaleToForm(values[offset++]));
             }
@@ -148,7 +152,6 @@ public: /* methods */
  
         return ret;
     }
-#endif
 
     /**
      * Add values to show. 
@@ -161,56 +164,40 @@ public: /* methods */
      * @retval true - success false - failed. 
      */
     template<typename T>
-    bool addValues(uint8_t ch, T *values, uint16_t len)
+    bool addValues(uint8_t ch, T *values, size_t len)
     {
-        #ifdef ESP8266
-        // compile time data type check 
-        static_assert(std::is_arithmetic<T>::value, "Not numeric type");
-        #endif
-
-        bool ret=true;
- 
-        for(uint16_t offset{0}; offset < len && ret;)
-        {
-            uint32_t sendBytes{len-offset};
-            if(sendBytes>124)
-            {
-                sendBytes=124;
-            }
-            { 
-            char buf[4] = {0};
-            utoa(getObjCid(), buf, 10);
-            String cmd;
-            cmd = "addt ";
-            cmd += buf;
-            cmd += ",";
-            utoa(ch, buf, 10);
-            cmd += buf;
-            cmd += ",";
-            utoa(sendBytes, buf, 10);
-            cmd += buf;
-            sendCommand(cmd.c_str());
-            }
-
-            if(!RecvTransparendDataModeReady())
-            {
-                ret=false;
-                break;
-            }
-            for(uint16_t i{0}; i<sendBytes; ++i)
-            {
-                sendRawByte(ScaleToForm(values[offset++]));
-            }
-            if(!RecvTransparendDataModeFinished())
-            {
-                ret=false;
-            }
-        }
- 
-        return ret;
+        return addValues(ch, NexSpan<T>(values, len));
     }
 
+    /**
+     * Add values to show. 
+     * 
+     * @tparam T - typename (numeeric tupes supported)
+     * @param ch - channel of waveform(0-3). 
+     * @param values - array of the values of waveform
+     *
+     * @retval true - success false - failed. 
+     */
+    template<typename T, size_t N>
+    bool addValues(uint8_t ch, T (&values)[N])
+    {
+        return addValues(ch, NexSpan<T>(values));
+    }
 
+    /**
+     * Add values to show. 
+     *
+     * @tparam C - container type having data() and size() (std::vector, std::array...)
+     * @param ch - channel of waveform(0-3). 
+     * @param values - the values of waveform (values are scaled to nextion resolution 0-255 based on Min / Max component hight).  
+     *
+     * @return true if success, false for failure
+     */
+    template<typename C, typename = decltype(((const C*)nullptr)->data())>
+    bool addValues(uint8_t ch, const C &values)
+    {
+        return addValues(ch, nexSpan(values));
+    }
 
     /**
      * Get bco attribute of component
@@ -25,28 +25,38 @@
 #include "Arduino.h"
 #include "NexConfig.h"
 #include "NexHardwareInterface.h"
+#include "NexSpan.h"
 #include "NextionIf.h"
 #include "NexTouch.h"
 #include "NexHardware.h"
+#include "NexLog.h"
+#include "NexProfiler.h"
 
 #include "NexButton.h"
 #include "NexCheckbox.h"
 #include "NexCrop.h"
 #include "NexDualStateButton.h"
+#include "NexEeprom.h"
 #include "NexGauge.h"
+#include "NexGesture.h"
 #include "NexGpio.h"
 #include "NexHotspot.h"
+#include "NexHotspotGrid.h"
 #include "NexNumber.h"
 #include "NexPage.h"
 #include "NexPicture.h"
 #include "NexProgressBar.h"
 #include "NexRadio.h"
+#ifdef NEX_ENABLE_DISCOVERY
+#include "NexRegistry.h"
+#endif
 #include "NexRtc.h"
 #include "NexScreen.h"
 #include "NexScrolltext.h"
 #include "NexSlider.h"
 #include "NexText.h"
 #include "NexTimer.h"
+#include "NexTimerWheel.h"
 #ifdef NEX_ENABLE_TFT_UPLOAD
 #include "NexUpload.h"
 #endif
@@ -13,6 +13,7 @@
 #include "NexConfig.h"
 #include "NexHardwareInterface.h"
 class Nextion;
+struct NexInstanceConfig;
 
 
 /**
@@ -40,7 +41,7 @@ public:
 * @retval true - success.
 * @retval false - failed. 
 */
-bool recvRetNumber(uint32_t *number, size_t timeout = NEX_TIMEOUT_RETURN) final;
+bool recvRetNumber(uint32_t *number, size_t timeout = NEX_TIMEOUT_DEFAULT) final;
 
 /* Receive signed number
 *
@@ -50,7 +51,7 @@ bool recvRetNumber(uint32_t *number, size_t timeout = NEX_TIMEOUT_RETURN) final;
 * @retval true - success.
 * @retval false - failed. 
 */
-bool recvRetNumber(int32_t *number, size_t timeout = NEX_TIMEOUT_RETURN) final;
+bool recvRetNumber(int32_t *number, size_t timeout = NEX_TIMEOUT_DEFAULT) final;
 
 /* Receive string
 *
@@ -61,7 +62,7 @@ bool recvRetNumber(int32_t *number, size_t timeout = NEX_TIMEOUT_RETURN) final;
 * @retval true - success.
 * @retval false - failed. 
 */
-virtual bool recvRetString(String &str, size_t timeout = NEX_TIMEOUT_RETURN, bool start_flag = true) final;
+virtual bool recvRetString(String &str, size_t timeout = NEX_TIMEOUT_DEFAULT, bool start_flag = true) final;
 
 /* Receive string
 *
@@ -73,7 +74,32 @@ virtual bool recvRetString(String &str, size_t timeout = NEX_TIMEOUT_RETURN, boo
 * @retval true - success.
 * @retval false - failed. 
 */
-bool recvRetString(char *buffer, uint16_t &len, size_t timeout = NEX_TIMEOUT_RETURN, bool start_flag = true) final;
+bool recvRetString(char *buffer, uint16_t &len, size_t timeout = NEX_TIMEOUT_DEFAULT, bool start_flag = true) final;
+
+/* Receive string
+*
+* @param buffer - received value buffer
+* @param len - in buffer size / out received string length
+* @param truncated - true if string did not fit to buffer
+* @param timeout - set timeout time.
+* @param start_flag - is str start flag (0x70) expected, default falue true
+*
+* @retval true - success.
+* @retval false - failed. 
+*/
+bool recvRetString(char *buffer, uint16_t &len, bool &truncated, size_t timeout = NEX_TIMEOUT_DEFAULT, bool start_flag = true) final;
+
+/* Receive string without intermediate buffering
+*
+* @param sink - called with received string chunks as they arrive
+* @param ptr - parameter passed into sink
+* @param timeout - set timeout time.
+* @param start_flag - is str start flag (0x70) expected, default falue true
+*
+* @retval true - success.
+* @retval false - failed. 
+*/
+bool recvRetString(NexStringSinkCb sink, void *ptr, size_t timeout = NEX_TIMEOUT_DEFAULT, bool start_flag = true) final;
 
 /* Send Command to device
 *
@@ -81,6 +107,16 @@ bool recvRetString(char *buffer, uint16_t &len, size_t timeout = NEX_TIMEOUT_RET
 */
 void sendCommand(const char* cmd) final;
 
+/* Queue command to be sent from nexLoop
+*
+* Pending assignment to the same attribute is replaced by the new value.
+*
+* parameter command string
+* parameter deadline maximum time (ms) in queue, command is dropped when expired, 0 no limit
+* return true if queued, false if queue is full
+*/
+bool postCommand(const char* cmd, uint32_t deadline = 0) final;
+
 /* Send Raw data to device
 *
 * parameter raw data buffer
@@ -96,6 +132,12 @@ void sendRawData(const std::vector<uint8_t> &data) final;
 */
 void sendRawData(const uint8_t *buf, uint16_t len) final;
 
+/* Send Raw data to device
+*
+* @param data - raw data span, any length
+*/
+void sendRawData(NexSpan<const uint8_t> data) final;
+
 
 /* Send Raw byte to device
 *
@@ -111,7 +153,7 @@ void sendRawByte(const uint8_t byte) final;
  * @param timeout  timeout ms
  * @return size_t read bytes can be less that size (timeout case) 
  */
-size_t readBytes(uint8_t* buffer, size_t size, size_t timeout =NEX_TIMEOUT_RETURN) final;
+size_t readBytes(uint8_t* buffer, size_t size, size_t timeout = NEX_TIMEOUT_DEFAULT) final;
 
 /* Receive command
 *
@@ -132,7 +174,7 @@ bool recvCommand(const uint8_t command, size_t timeout) final;
  * @retval false - failed. 
  *
  */
-bool recvRetCommandFinished(size_t timeout = NEX_TIMEOUT_COMMAND) final;
+bool recvRetCommandFinished(size_t timeout = NEX_TIMEOUT_DEFAULT) final;
 
 /*
  * Transpared data mode setup successfully 
@@ -143,7 +185,7 @@ bool recvRetCommandFinished(size_t timeout = NEX_TIMEOUT_COMMAND) final;
  * @retval false - failed. 
  *
  */
-bool RecvTransparendDataModeReady(size_t timeout = NEX_TIMEOUT_TRANSPARENT_DATA_MODE) final;
+bool RecvTransparendDataModeReady(size_t timeout = NEX_TIMEOUT_DEFAULT) final;
 
 /*
  * Transpared data mode finished 
@@ -154,7 +196,16 @@ bool RecvTransparendDataModeReady(size_t timeout = NEX_TIMEOUT_TRANSPARENT_DATA_
  * @retval false - failed. 
  *
  */
-bool RecvTransparendDataModeFinished(size_t timeout = NEX_TIMEOUT_COMMAND) final;
+bool RecvTransparendDataModeFinished(size_t timeout = NEX_TIMEOUT_DEFAULT) final;
+
+/**
+ * receive connect reply
+ * 
+ * @param timeout - maximum wait time, returns as soon as comok is received
+ * 
+ * @return true if display replied comok
+ */
+bool RecvConnect(size_t timeout = NEX_TIMEOUT_DEFAULT) final;
 
 /**
  * current baud value
@@ -164,6 +215,13 @@ bool RecvTransparendDataModeFinished(size_t timeout = NEX_TIMEOUT_COMMAND) final
  */
 uint32_t GetCurrentBaud() final;
 
+/**
+ * configuration of nextion instance, e.g. timeouts
+ * 
+ * @return instance configuration
+ */
+const NexInstanceConfig &GetConfig() const;
+
 
 private: // data
     Nextion *m_nextion; // nextion interface instance
@@ -33,7 +33,12 @@ bool NexCheckbox::getValue(uint32_t *number)
     getObjGlobalPageName(cmd);
     cmd += ".val";
     sendCommand(cmd.c_str());
-    return recvRetNumber(number);
+    bool ret = recvRetNumber(number);
+    if (ret)
+    {
+        setCachedValue(*number);
+    }
+    return ret;
 }
 
 bool NexCheckbox::setValue(uint32_t number)
@@ -46,7 +51,12 @@ bool NexCheckbox::setValue(uint32_t number)
     cmd += ".val=";
     cmd += buf;
     sendCommand(cmd.c_str());
-    return recvRetCommandFinished();
+    bool ret = recvRetCommandFinished();
+    if (ret)
+    {
+        setCachedValue(number);
+    }
+    return ret;
 }
 
 bool NexCheckbox::Get_background_color_bco(uint32_t *number)
@@ -0,0 +1,53 @@
+/**
+ * @file NexEeprom.cpp
+ *
+ * The implementation of class NexEeprom. 
+ *
+ * @author Enhanced-Nextion-Library contributors 10/18/2026
+ * 
+ * @copyright 2026 Enhanced-Nextion-Library contributors
+ */
+
+#include "NexEeprom.h"
+
+#include "NexHardware.h"
+
+static void eepromCommand(String &cmd, const char *op, uint16_t address, size_t len)
+{
+    char buf[11] = {0};
+    cmd += op;
+    utoa(address, buf, 10);
+    cmd += buf;
+    cmd += ",";
+    ultoa(len, buf, 10);
+    cmd += buf;
+}
+
+NexEeprom::NexEeprom(Nextion *nextion):NextionIf(nextion)
+{}
+
+NexEeprom::~NexEeprom()
+{}
+
+bool NexEeprom::write(uint16_t address, NexSpan<const uint8_t> data)
+{
+    String cmd;
+    eepromCommand(cmd, "wept ", address, data.size());
+    sendCommand(cmd.c_str());
+    if(!RecvTransparendDataModeReady())
+    {
+        return false;
+    }
+    sendRawData(data);
+    return RecvTransparendDataModeFinished();
+}
+
+bool NexEeprom::read(uint16_t address, NexSpan<uint8_t> data)
+{
+    String cmd;
+    eepromCommand(cmd, "rept ", address, data.size());
+    sendCommand(cmd.c_str());
+    // reply is raw data, allow transfer time (10 bits per byte)
+    size_t timeout = GetConfig().returnTimeout + data.size() * 10000UL / GetCurrentBaud();
+    return readBytes(data.data(), data.size(), timeout) == data.size();
+}
@@ -46,6 +46,17 @@ bool NexGauge::setValue(uint32_t number)
     return recvRetCommandFinished();
 }
 
+bool NexGauge::postValue(uint32_t number, uint32_t deadline)
+{
+    char buf[12] = {0};
+    String cmd;
+    utoa(number, buf, 10);
+    getObjGlobalPageName(cmd);
+    cmd += ".val=";
+    cmd += buf;
+    return postCommand(cmd.c_str(), deadline);
+}
+
 bool NexGauge::Get_background_color_bco(uint32_t *number)
 {
     String cmd;
@@ -0,0 +1,182 @@
+/**
+ * @file NexGesture.cpp
+ *
+ * The implementation of class NexGesture. 
+ *
+ * @author Enhanced-Nextion-Library contributors 10/18/2026
+ * 
+ * @copyright 2026 Enhanced-Nextion-Library contributors
+ */
+
+#include "NexGesture.h"
+#include "NexTouch.h"
+
+static uint16_t distance(uint16_t a, uint16_t b)
+{
+    return a > b ? a - b : b - a;
+}
+
+NexGesture::NexGesture(Nextion *nextion):NextionIf(nextion), m_owner{nextion}
+{
+    nextion->addCoordinateListener(this);
+}
+
+NexGesture::~NexGesture()
+{
+    m_owner->removeCoordinateListener(this);
+}
+
+bool NexGesture::enable(bool enable)
+{
+    sendCommand(enable ? "sendxy=1" : "sendxy=0");
+    return recvRetCommandFinished();
+}
+
+void NexGesture::attachGesture(NexGestureCb gesture, void *ptr)
+{
+    m_cb = gesture;
+    m_cbPtr = ptr;
+}
+
+void NexGesture::setConfig(const NexGestureConfig &config)
+{
+    m_config = config;
+}
+
+uint32_t NexGesture::GetLastLatency() const
+{
+    return m_lastLatency;
+}
+
+uint32_t NexGesture::GetMaxLatency() const
+{
+    return m_maxLatency;
+}
+
+void NexGesture::Emit(NexGestureType type, uint16_t x, uint16_t y, int16_t dx, int16_t dy, uint32_t duration, uint32_t completed)
+{
+    m_lastLatency = micros() - completed;
+    if(m_lastLatency > m_maxLatency)
+    {
+        m_maxLatency = m_lastLatency;
+    }
+    if(m_cb)
+    {
+        NexGestureEvent gesture{type, x, y, dx, dy, duration / 1000, m_lastLatency};
+        m_cb(gesture, m_cbPtr);
+    }
+}
+
+void NexGesture::FlushTap(uint32_t completed)
+{
+    if(m_tapPending)
+    {
+        m_tapPending = false;
+        Emit(NEX_GESTURE_TAP, m_tapX, m_tapY, 0, 0, m_tapDuration, completed);
+    }
+}
+
+void NexGesture::touchCoordinate(uint16_t x, uint16_t y, uint8_t event, uint32_t time)
+{
+    if(event == NEX_EVENT_POP)
+    {
+        if(m_down)
+        {
+            Release(x, y, time);
+        }
+        return;
+    }
+    if(!m_down)
+    {
+        if(m_tapPending && time - m_tapTime > m_config.doubleTapTime * 1000UL)
+        {
+            // nexLoop was not polled in time
+            FlushTap(m_tapTime + m_config.doubleTapTime * 1000UL);
+        }
+        m_down = true;
+        m_dragging = false;
+        m_longPressed = false;
+        m_startX = m_lastX = x;
+        m_startY = m_lastY = y;
+        m_startTime = time;
+        return;
+    }
+    // move sample
+    if(!m_dragging && !m_longPressed &&
+        (distance(x, m_startX) > m_config.tapSlop || distance(y, m_startY) > m_config.tapSlop))
+    {
+        m_dragging = true;
+        FlushTap(time);
+    }
+    if(m_dragging)
+    {
+        Emit(NEX_GESTURE_DRAG, m_startX, m_startY, (int16_t)(x - m_lastX), (int16_t)(y - m_lastY), time - m_startTime, time);
+    }
+    m_lastX = x;
+    m_lastY = y;
+}
+
+void NexGesture::Release(uint16_t x, uint16_t y, uint32_t time)
+{
+    m_down = false;
+    if(m_longPressed)
+    {
+        return;
+    }
+    uint16_t adx{distance(x, m_startX)};
+    uint16_t ady{distance(y, m_startY)};
+    int16_t dx = (int16_t)(x - m_startX);
+    int16_t dy = (int16_t)(y - m_startY);
+    uint32_t duration{time - m_startTime};
+    if((adx >= m_config.swipeDistance || ady >= m_config.swipeDistance) &&
+        duration <= m_config.swipeTime * 1000UL)
+    {
+        NexGestureType type;
+        if(adx >= ady)
+        {
+            type = dx < 0 ? NEX_GESTURE_SWIPE_LEFT : NEX_GESTURE_SWIPE_RIGHT;
+        }
+        else
+        {
+            type = dy < 0 ? NEX_GESTURE_SWIPE_UP : NEX_GESTURE_SWIPE_DOWN;
+        }
+        FlushTap(time);
+        Emit(type, m_startX, m_startY, dx, dy, duration, time);
+        return;
+    }
+    if(m_dragging || adx > m_config.tapSlop || ady > m_config.tapSlop)
+    {
+        FlushTap(time);
+        return;
+    }
+    // time between taps is from first release to second press
+    if(m_tapPending && m_startTime - m_tapTime <= m_config.doubleTapTime * 1000UL)
+    {
+        m_tapPending = false;
+        Emit(NEX_GESTURE_DOUBLE_TAP, m_tapX, m_tapY, 0, 0, time - m_tapStart, time);
+        return;
+    }
+    FlushTap(time);
+    m_tapPending = true;
+    m_tapX = m_startX;
+    m_tapY = m_startY;
+    m_tapStart = m_startTime;
+    m_tapTime = time;
+    m_tapDuration = duration;
+}
+
+void NexGesture::poll(uint32_t now)
+{
+    if(m_down && !m_dragging && !m_longPressed &&
+        now - m_startTime >= m_config.longPressTime * 1000UL)
+    {
+        uint32_t completed = m_startTime + m_config.longPressTime * 1000UL;
+        m_longPressed = true;
+        FlushTap(completed);
+        Emit(NEX_GESTURE_LONG_PRESS, m_startX, m_startY, 0, 0, now - m_startTime, completed);
+    }
+    if(m_tapPending && !m_down && now - m_tapTime > m_config.doubleTapTime * 1000UL)
+    {
+        FlushTap(m_tapTime + m_config.doubleTapTime * 1000UL);
+    }
+}
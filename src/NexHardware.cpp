@@ -20,6 +20,8 @@
 
 #include "NexHardware.h"
 #include "NexTouch.h"
+#include "NexLog.h"
+#include "NexTimerWheel.h"
 
 
 #define NEX_RET_EVENT_NEXTION_STARTUP       (0x00)
@@ -36,25 +38,11 @@
 #define Nex_RET_TRANSPARENT_DATA_FINISHED   (0xFD)
 #define Nex_RET_TRANSPARENT_DATA_READY      (0xFE)
 
-#define NEX_RET_INVALID_CMD             (0x00)
-#define NEX_RET_CMD_FINISHED_OK         (0x01)
-#define NEX_RET_INVALID_COMPONENT_ID    (0x02)
-#define NEX_RET_INVALID_PAGE_ID         (0x03)
-#define NEX_RET_INVALID_PICTURE_ID      (0x04)
-#define NEX_RET_INVALID_FONT_ID         (0x05)
-#define NEX_RET_INVALID_FILE_OPERATION  (0x06)
-#define NEX_RET_INVALID_CRC             (0x09)
-#define NEX_RET_INVALID_BAUD            (0x11)
-#define NEX_RET_INVALID_WAVEFORM_ID_OR_CHANNEL_NRO  (0x12)
-#define NEX_RET_INVALID_VARIABLE_OR_ATTRIBUTE       (0x1A)
-#define NEX_RET_INVALID_VARIABLE_OPERATION          (0x1B)
-#define NEX_RET_ASSIGNMENT_FAILED_TO_ASSIGN         (0x1C)
-#define NEX_RET_EEPROM_OPERATION_FAILED             (0x1D)
-#define NEX_RET_INVALID_QUANTITY_OF_PARAMETERS      (0x1E)
-#define NEX_RET_IO_OPERATION_FAILED                 (0x1F)
-#define NEX_RET_ESCAPE_CHARACTER_INVALID            (0x20)
-#define NEX_RET_VARIABLE_NAME_TOO_LONG              (0x23)
-#define NEX_RET_SERIAL_BUFFER_OVERFLOW              (0x24)
+// maximum time for display to change baud rate (ms)
+#define NEX_BAUD_SETTLE_TIME                (100)
+// connect reply wait time while display is changing baud (ms)
+#define NEX_CONNECT_PROBE_TIME              (20)
+
 
 const uint32_t Nextion::baudRates[]{2400, 4800, 9600, 19200, 31250, 38400, 57600, 115200, 230400, 250000, 256000, 512000, 921600};
 
@@ -70,57 +58,343 @@ static uint8_t _nextion_queued_events[][2] =
     {NEX_RET_AUTOMATIC_WAKE_UP,         4},
     {NEX_RET_EVENT_NEXTION_READY,       1},
     {NEX_RET_START_SD_UPGRADE,          1},
+    {NEX_RET_VALUE_CHANGE_HEAD,         10},
     {0xFF,                              0}  // end of list
 };
 
-void Nextion::ReadQueuedEvents()
+// Nextion return codes and own data heads which cannot be used as custom event header
+static bool isReservedHeader(uint8_t header)
+{
+    if(header <= NEX_RET_SERIAL_BUFFER_OVERFLOW)
+    {
+        return true;
+    }
+    for(uint8_t i{0}; _nextion_queued_events[i][1]; ++i)
+    {
+        if(header == _nextion_queued_events[i][0])
+        {
+            return true;
+        }
+    }
+    return header == NEX_RET_STRING_HEAD ||
+        header == NEX_RET_NUMBER_HEAD ||
+        header == Nex_RET_TRANSPARENT_DATA_FINISHED ||
+        header == Nex_RET_TRANSPARENT_DATA_READY ||
+        header == 0xFF;
+}
+
+// reply frame length by header, 0 for 0xFF 0xFF 0xFF terminated string, -1 if not a reply frame
+static int replyLength(uint8_t header)
+{
+    if(header == NEX_RET_NUMBER_HEAD)
+    {
+        return 8;
+    }
+    if(header == NEX_RET_STRING_HEAD)
+    {
+        return 0;
+    }
+    if(header <= NEX_RET_SERIAL_BUFFER_OVERFLOW ||
+        header == Nex_RET_TRANSPARENT_DATA_FINISHED ||
+        header == Nex_RET_TRANSPARENT_DATA_READY)
+    {
+        return 4;
+    }
+    return -1;
+}
+
+// error return code ends any request
+static bool isErrorReply(uint8_t header)
+{
+    return header <= NEX_RET_SERIAL_BUFFER_OVERFLOW && header != NEX_RET_CMD_FINISHED_OK;
+}
+
+// number, optionally signed, or single quoted string
+static bool isLiteral(const char *value)
+{
+    if(*value == '"')
+    {
+        for(++value; *value && *value != '"'; ++value)
+        {
+            if(*value == '\\' && value[1])
+            {
+                // escaped character
+                ++value;
+            }
+        }
+        return *value == '"' && value[1] == 0;
+    }
+    if(*value == '-' || *value == '+')
+    {
+        ++value;
+    }
+    if(*value < '0' || *value > '9')
+    {
+        return false;
+    }
+    while(*value >= '0' && *value <= '9')
+    {
+        ++value;
+    }
+    return *value == 0;
+}
+
+// command class for retry policy, only assignments of literal value and queries are idempotent
+static NexCommandClass classifyCommand(const char *cmd)
+{
+    if(strncmp(cmd, "get ", 4) == 0)
+    {
+        return NEX_CMD_QUERY;
+    }
+    if(strncmp(cmd, "baud", 4) == 0)
+    {
+        // link speed change can not be repeated at old speed
+        return NEX_CMD_NON_IDEMPOTENT;
+    }
+    const char *assign = strchr(cmd, '=');
+    if(!assign || assign == cmd)
+    {
+        return NEX_CMD_NON_IDEMPOTENT;
+    }
+    for(const char *c = cmd; c < assign; ++c)
+    {
+        if(*c == ' ' || *c == '"' || *c == '+' || *c == '-' || *c == '*' || *c == '/' || *c == '%' || *c == '&' || *c == '|' || *c == '^')
+        {
+            // not a plain attribute, or compound assignment like txt+=
+            return NEX_CMD_NON_IDEMPOTENT;
+        }
+    }
+    // value referring attributes or using operators, like n0.val=n0.val+1, changes when repeated
+    return isLiteral(assign + 1) ? NEX_CMD_ASSIGNMENT : NEX_CMD_NON_IDEMPOTENT;
+}
+
+// timeout parameter or instance configured timeout
+static size_t resolveTimeout(size_t timeout, size_t configured)
+{
+    return timeout == NEX_TIMEOUT_DEFAULT ? configured : timeout;
+}
+
+// return codes which may succeed when command is repeated
+static bool isRetryableCode(uint8_t code)
+{
+    return code == NEX_RET_NO_REPLY ||
+        code == NEX_RET_INVALID_CMD ||
+        code == NEX_RET_SERIAL_BUFFER_OVERFLOW;
+}
+
+// coalescing key length of queued command, 0 if command can not be coalesced
+static uint8_t coalescingKeyLength(const char *cmd)
+{
+    if(classifyCommand(cmd) != NEX_CMD_ASSIGNMENT)
+    {
+        // value depending on earlier value (n0.val=n0.val+1) must not replace or be replaced
+        return 0;
+    }
+    // key includes '=' e.g. "page0.n0.val="
+    return strchr(cmd, '=') - cmd + 1;
+}
+
+bool Nextion::registerCustomEvent(uint8_t header, uint8_t length, NexCustomEventCb callback, void *ptr)
+{
+    if(isReservedHeader(header) || length > NEX_MAX_EVENT_FRAME_SIZE || callback == nullptr)
+    {
+        return false;
+    }
+    nexCustomEvent *event = const_cast<nexCustomEvent*>(FindCustomEvent(header));
+    if(!event)
+    {
+        if(m_customEventCount >= NEX_MAX_CUSTOM_EVENTS)
+        {
+            return false;
+        }
+        event = &m_customEvents[m_customEventCount++];
+    }
+    event->header = header;
+    event->length = length;
+    event->callback = callback;
+    event->ptr = ptr;
+    return true;
+}
+
+bool Nextion::unregisterCustomEvent(uint8_t header)
+{
+    for(uint8_t i{0}; i < m_customEventCount; ++i)
+    {
+        if(m_customEvents[i].header == header)
+        {
+            m_customEvents[i] = m_customEvents[--m_customEventCount];
+            return true;
+        }
+    }
+    return false;
+}
+
+void Nextion::setTimerWheel(NexTimerWheel *wheel)
+{
+    m_timerWheel = wheel;
+}
+
+void Nextion::addCoordinateListener(NexCoordinateListener *listener)
+{
+    removeCoordinateListener(listener);
+    listener->m_nextCoordinateListener = m_coordinateListeners;
+    m_coordinateListeners = listener;
+}
+
+bool Nextion::removeCoordinateListener(NexCoordinateListener *listener)
+{
+    for(NexCoordinateListener **link = &m_coordinateListeners; *link; link = &(*link)->m_nextCoordinateListener)
+    {
+        if(*link == listener)
+        {
+            *link = listener->m_nextCoordinateListener;
+            listener->m_nextCoordinateListener = nullptr;
+            return true;
+        }
+    }
+    return false;
+}
+
+const nexCustomEvent* Nextion::FindCustomEvent(uint8_t header) const
 {
-    for(int c=m_nexSerial->peek(); c!=-1; c=m_nexSerial->peek())
+    for(uint8_t i{0}; i < m_customEventCount; ++i)
     {
-        int i{0};
-        for(; _nextion_queued_events[i][1]; ++i)
+        if(m_customEvents[i].header == header)
+        {
+            return &m_customEvents[i];
+        }
+    }
+    return nullptr;
+}
+
+bool Nextion::ReadTerminatedFrame(uint8_t *buffer, uint16_t size, uint8_t &len)
+{
+    uint8_t cnt_0xff{0};
+    while(cnt_0xff < 3)
+    {
+        if(len >= size)
+        {
+            NEX_LOG_WARNING(NEX_LOG_EVENT_FRAME_TOO_LONG, buffer[0]);
+            return false;
+        }
+        if(readBytes(&buffer[len], 1, 20) != 1)
+        {
+            return false;
+        }
+        cnt_0xff = (buffer[len] == 0xFF) ? cnt_0xff + 1 : 0;
+        ++len;
+    }
+    return true;
+}
+
+// queued event entry: length, arrival time and frame
+#define NEX_EVENT_ENTRY_HEADER 5
+
+bool Nextion::ReserveEventSpace(uint16_t size)
+{
+    if(m_eventBufferEnd)
+    {
+        // wrapped, room up to the frame being handled
+        return m_eventBufferInUse - m_eventBufferLen >= size;
+    }
+    if(m_config.eventBufferSize - m_eventBufferLen >= size)
+    {
+        return true;
+    }
+    if(m_eventBufferInUse >= size)
+    {
+        // handled frames before the frame being handled are reclaimed, continue from buffer start
+        m_eventBufferEnd = m_eventBufferLen;
+        m_eventBufferLen = 0;
+        return true;
+    }
+    return false;
+}
+
+bool Nextion::ReadQueuedEvents()
+{
+    for(int c=RxPeek(); c!=-1; c=RxPeek())
+    {
+        uint8_t len{0};
+        for(int i{0}; _nextion_queued_events[i][1]; ++i)
         {
             if(c==_nextion_queued_events[i][0])
             {
-                nexQueuedEvent *event = new nexQueuedEvent();
-                if(readBytes(&event->event_data[0],_nextion_queued_events[i][1],20)!= _nextion_queued_events[i][1])
-                {
-                    delete event;
-                    return;
-                }
-                if(!m_queuedEvents)
-                {
-                    m_queuedEvents = event;
-                }
-                else
-                {
-                    nexQueuedEvent *last = m_queuedEvents->m_next;
-                    while( last->m_next)
-                    {
-                        last = last->m_next;
-                    }
-                    last->m_next=event;
-                }
-                yield();
+                len = _nextion_queued_events[i][1];
+                break;
+            }
+        }
+        if(!len)
+        {
+            const nexCustomEvent *custom = FindCustomEvent(c);
+            if(!custom)
+            {
+                return false;
+            }
+            len = custom->length;
+        }
+        else if(c == NEX_RET_EVENT_NEXTION_STARTUP && RxPeekAt(1) != 0x00)
+        {
+            // 0x00 0xFF 0xFF 0xFF is invalid instruction reply, startup event is 0x00 0x00 0x00 0xFF 0xFF 0xFF
+            return false;
+        }
+
+        // frame is read directly to the event buffer after its length byte and arrival time
+        if(!ReserveEventSpace(NEX_EVENT_ENTRY_HEADER + (len ? len : NEX_MAX_EVENT_FRAME_SIZE)))
+        {
+            // no room, frame is kept in receive buffer until queued events are handled
+            return true;
+        }
+        uint8_t *frame = &m_eventBuffer[m_eventBufferLen + NEX_EVENT_ENTRY_HEADER];
+        if(len)
+        {
+            if(readBytes(frame, len, 20) != len)
+            {
+                return false;
             }
         }
-        if(!_nextion_queued_events[i][1])
+        else
         {
-            return;
+            // custom event frame terminated by 0xFF 0xFF 0xFF
+            frame[len++] = RxRead();
+            if(!ReadTerminatedFrame(frame, NEX_MAX_EVENT_FRAME_SIZE, len))
+            {
+                return false;
+            }
         }
+        uint32_t time{micros()};
+        m_eventBuffer[m_eventBufferLen] = len;
+        memcpy(&m_eventBuffer[m_eventBufferLen + 1], &time, sizeof(time));
+        m_eventBufferLen += NEX_EVENT_ENTRY_HEADER + len;
+        yield();
     }
-    return;
+    return false;
 }
 
-nexQueuedEvent* Nextion::GetQueuedEvent()
+bool Nextion::GetQueuedEvent(NexEventFrame &frame)
 {
-    nexQueuedEvent *tmp{m_queuedEvents};
-    if(tmp)
+    if(m_eventBufferEnd && m_eventBufferPos >= m_eventBufferEnd)
+    {
+        // frames before wrap are handled, continue from buffer start
+        m_eventBufferPos = 0;
+        m_eventBufferEnd = 0;
+    }
+    if(!m_eventBufferEnd && m_eventBufferPos >= m_eventBufferLen)
     {
-        m_queuedEvents = m_queuedEvents->m_next;
-        tmp->m_next=0;
+        // all handled, frames are not referenced anymore
+        m_eventBufferPos = 0;
+        m_eventBufferLen = 0;
+        m_eventBufferInUse = 0;
+        return false;
     }
-    return tmp;
+    // previous frame is handled, its space can be reused
+    m_eventBufferInUse = m_eventBufferPos;
+    uint8_t len = m_eventBuffer[m_eventBufferPos];
+    uint32_t time;
+    memcpy(&time, &m_eventBuffer[m_eventBufferPos + 1], sizeof(time));
+    frame = NexEventFrame(&m_eventBuffer[m_eventBufferPos + NEX_EVENT_ENTRY_HEADER], len, time);
+    m_eventBufferPos += NEX_EVENT_ENTRY_HEADER + len;
+    return true;
 }
 
 
@@ -128,6 +402,8 @@ nexQueuedEvent* Nextion::GetQueuedEvent()
 
 #ifdef NEX_ENABLE_HW_SERIAL
 Nextion::Nextion(HardwareSerial &nexSerial):m_nexSerialType{HW},m_nexSerial{&nexSerial},
+    waitForDataCallback{nullptr},
+    eventFrameCallback{nullptr},
     nextionStartupCallback{nullptr},
     currentPageIdCallback{nullptr},
     touchCoordinateCallback{nullptr},
@@ -146,6 +422,8 @@ Nextion* Nextion::GetInstance(HardwareSerial &nexSerial)
 
 #ifdef NEX_ENABLE_SW_SERIAL
 Nextion::Nextion(SoftwareSerial &nexSerial):m_nexSerialType{SW},m_nexSerial{&nexSerial},
+    waitForDataCallback{nullptr},
+    eventFrameCallback{nullptr},
     nextionStartupCallback{nullptr},
     currentPageIdCallback{nullptr},
     touchCoordinateCallback{nullptr},
@@ -158,6 +436,8 @@ Nextion::Nextion(SoftwareSerial &nexSerial):m_nexSerialType{SW},m_nexSerial{&nex
 
 #ifdef USBCON
 Nextion::Nextion(Serial_ &nexSerial):m_nexSerialType{HW_USBCON},m_nexSerial{&nexSerial},
+    waitForDataCallback{nullptr},
+    eventFrameCallback{nullptr},
     nextionStartupCallback{nullptr},
     currentPageIdCallback{nullptr},
     touchCoordinateCallback{nullptr},
@@ -184,50 +464,79 @@ Nextion::~Nextion()
 
 
 bool Nextion::connect()
+{
+    SendConnect();
+    return RecvConnect();
+}
+
+void Nextion::SendConnect()
 {
     sendCommand("");
     sendCommand("connect");
-    String resp;
-    recvRetString(resp,NEX_TIMEOUT_RETURN, false);
-    if(resp.indexOf("comok") != -1)
-    {
-        dbSerialPrint("Nextion device details: ");
-        dbSerialPrintln(resp);
-        return true;
-    }
-    return false;
 }
 
-bool Nextion::findBaud(uint32_t &baud)
+bool Nextion::RecvConnect(size_t timeout)
 {
-    for(uint8_t i = 0; i < (sizeof(baudRates)/sizeof(baudRates[0])); i++)
+    timeout = resolveTimeout(timeout, m_config.returnTimeout);
+    uint32_t start{millis()};
+    String resp;
+    while(true)
     {
-        if (m_nexSerialType==HW)
+        if(ReadQueuedEvents())
         {
-            ((HardwareSerial*)m_nexSerial)->begin(baudRates[i]);
+            return false;
         }
-#ifdef NEX_ENABLE_SW_SERIAL
-        if (m_nexSerialType==SW)
+        int c = RxPeek();
+        if(c < 0)
         {
-            ((SoftwareSerial*)m_nexSerial)->begin(baudRates[i]);
+            if(!WaitForData(start, timeout))
+            {
+                return false;
+            }
+            continue;
         }
-#endif 
-#ifdef USBCON
-        if (m_nexSerialType==HW_USBCON)
+        // replies to preceding commands may be received before comok,
+        // anything else is garbage received at wrong baud
+        if(c != 'c' && c > NEX_RET_SERIAL_BUFFER_OVERFLOW)
         {
-            ((Serial_*)m_nexSerial)->begin(baudRates[i]);
+            return false;
         }
-#endif
-        delay(100);
-        if(connect())
+        uint32_t elapsed{millis()-start};
+        if(!recvRetString(resp, elapsed < timeout ? timeout - elapsed : 0, false))
         {
-            baud = baudRates[i];
-            dbSerialPrint("Nextion found baud: ");
-            dbSerialPrintln(baud);
+            return false;
+        }
+        if(resp.indexOf("comok") != -1)
+        {
+            dbSerialPrint("Nextion device details: ");
+            dbSerialPrintln(resp);
             return true;
         }
+        if(c == 'c' || resp.length() > 1)
+        {
+            return false;
+        }
+    }
+}
+
+void Nextion::SerialBegin(uint32_t baud)
+{
+    if (m_nexSerialType==HW)
+    {
+        ((HardwareSerial*)m_nexSerial)->begin(baud);
+    }
+#ifdef NEX_ENABLE_SW_SERIAL
+    if (m_nexSerialType==SW)
+    {
+        ((SoftwareSerial*)m_nexSerial)->begin(baud);
+    }
+#endif 
+#ifdef USBCON
+    if (m_nexSerialType==HW_USBCON)
+    {
+        ((Serial_*)m_nexSerial)->begin(baud);
     }
-    return false; 
+#endif
 }
 
 /*
@@ -242,43 +551,7 @@ bool Nextion::findBaud(uint32_t &baud)
  */
 bool Nextion::recvRetNumber(uint32_t *number, size_t timeout)
 {
-    bool ret = false;
-    uint8_t temp[8] = {0};
-
-    if (!number)
-    {
-        goto __return;
-    }
-
-    ReadQueuedEvents();
-    if (sizeof(temp) != readBytes(temp, sizeof(temp),timeout))
-    {
-        goto __return;
-    }
-
-    if (temp[0] == NEX_RET_NUMBER_HEAD
-        && temp[5] == 0xFF
-        && temp[6] == 0xFF
-        && temp[7] == 0xFF
-        )
-    {
-        *number = ((uint32_t)temp[4] << 24) | ((uint32_t)temp[3] << 16) | ((uint32_t)temp[2] << 8) | (temp[1]);
-        ret = true;
-    }
-
-__return:
-
-    if (ret) 
-    {
-        dbSerialPrint("recvRetNumber: ");
-        dbSerialPrintln(*number);
-    }
-    else
-    {
-        dbSerialPrintln("recvRetNumber err");
-    }
-    
-    return ret;
+    return recvRetNumber(reinterpret_cast<int32_t*>(number), timeout);
 }
 
 /*
@@ -293,49 +566,87 @@ __return:
  */
 bool Nextion::recvRetNumber(int32_t *number, size_t timeout)
 {
+    timeout = resolveTimeout(timeout, m_config.returnTimeout);
     bool ret = false;
     uint8_t temp[8] = {0};
 
-    if (!number)
-    {
-        goto __return;
-    }
+    uint32_t start{millis()};
+    uint8_t attempt{0};
 
-    ReadQueuedEvents();
-    if (sizeof(temp) != readBytes(temp, sizeof(temp), timeout))
+    if (!number)
     {
         goto __return;
     }
 
-    if (temp[0] == NEX_RET_NUMBER_HEAD
-        && temp[5] == 0xFF
-        && temp[6] == 0xFF
-        && temp[7] == 0xFF
-        )
+    do
     {
-        *number = ((int32_t)temp[4] << 24) | ((int32_t)temp[3] << 16) | ((int32_t)temp[2] << 8) | (temp[1]);
-        ret = true;
-    }
+        if (sizeof(temp) == RecvReply(NEX_RET_NUMBER_HEAD, temp, sizeof(temp), timeout))
+        {
+            if (temp[0] == NEX_RET_NUMBER_HEAD
+                && temp[5] == 0xFF
+                && temp[6] == 0xFF
+                && temp[7] == 0xFF
+                )
+            {
+                *number = ((int32_t)temp[4] << 24) | ((int32_t)temp[3] << 16) | ((int32_t)temp[2] << 8) | (temp[1]);
+                ret = true;
+            }
+            else if (temp[0] == NEX_RET_NUMBER_HEAD)
+            {
+                // corrupted frame
+                m_lastReturnCode = NEX_RET_NO_REPLY;
+                FrameError();
+            }
+        }
+    } while (!ret && RetryCommand(attempt, start));
 
 __return:
 
     if (ret) 
     {
-        dbSerialPrint("recvRetNumber :");
-        dbSerialPrintln(*number);
+        NEX_LOG_DEBUG(NEX_LOG_RECV_NUMBER, *number);
     }
     else
     {
-        dbSerialPrintln("recvRetNumber err");
+        NEX_LOG_ERROR(NEX_LOG_RECV_NUMBER_ERR, m_lastReturnCode);
     }
     
     return ret;
 }
 
+// sink appending received string to String object, chunk is '\0' terminated
+static void stringSink(const char *chunk, size_t, void *ptr)
+{
+    *static_cast<String*>(ptr) += chunk;
+}
+
+// sink storing received string to caller buffer
+struct nexBufferSink
+{
+    char *buffer;
+    uint16_t size;
+    uint16_t len;
+    bool truncated;
+};
+
+static void bufferSink(const char *chunk, size_t len, void *ptr)
+{
+    nexBufferSink *sink = static_cast<nexBufferSink*>(ptr);
+    size_t space = sink->size - sink->len;
+    if(len > space)
+    {
+        len = space;
+        sink->truncated = true;
+    }
+    memcpy(&sink->buffer[sink->len], chunk, len);
+    sink->len += len;
+}
+
 /*
  * Receive string data. 
  * 
- * @param str - save string data. 
+ * @param sink - called with received string chunks. 
+ * @param ptr - parameter passed into sink. 
  * @param timeout - set timeout time. 
  * @param start_flag - is str start flag (0x70) expected, default falue true
  *
@@ -343,297 +654,1408 @@ __return:
  * @retval false - failed.
  *
  */
-bool Nextion::recvRetString(String &str, size_t timeout, bool start_flag)
+bool Nextion::recvRetString(NexStringSinkCb sink, void *ptr, size_t timeout, bool start_flag)
 {
-    str = "";
-    bool ret{false};
-    bool str_start_flag {!start_flag};
-    uint8_t cnt_0xff = 0;
-    uint8_t c = 0;
-    ReadQueuedEvents();
+    timeout = resolveTimeout(timeout, m_config.returnTimeout);
     uint32_t start{millis()};
-//    size_t avail{(size_t)m_nexSerial->available()};
-    while(ret == false && (millis()-start)<timeout)
+    uint8_t attempt{0};
+    size_t str_len{0};
+    bool ret;
+    do
     {
-        while (m_nexSerial->available())
+        ret = RecvString(sink, ptr, timeout, start_flag, str_len);
+    } while (!ret && str_len == 0 && RetryCommand(attempt, start));
+    return ret;
+}
+
+bool Nextion::RecvString(NexStringSinkCb sink, void *ptr, size_t timeout, bool start_flag, size_t &str_len)
+{
+    bool ret{false};
+    bool str_start_flag {!start_flag};
+    uint8_t cnt_0xff = 0;
+    uint8_t c = 0;
+    char chunk[NEX_STRING_CHUNK_SIZE + 1];
+    uint8_t chunk_len{0};
+    bool wait{true};
+    uint32_t start{millis()};
+    m_lastReturnCode = NEX_RET_NO_REPLY;
+    if(start_flag)
+    {
+        int header = WaitReplyHeader(NEX_RET_STRING_HEAD, start, timeout);
+        if(header < 0)
+        {
+            AbandonRequest(NEX_RET_STRING_HEAD);
+            wait = false;
+        }
+        else if(header != NEX_RET_STRING_HEAD && replyLength(header) > 0)
+        {
+            // error return code
+            m_lastReturnCode = header;
+            SkipReplyFrame(header);
+            wait = false;
+        }
+    }
+    else
+    {
+        ReadQueuedEvents();
+    }
+    while(wait && ret == false)
+    {
+        int r = RxRead();
+        if (r < 0)
+        {
+            if (!WaitForData(start, timeout))
+            {
+                break;
+            }
+            continue;
+        }
+        c = r;
+        if (str_start_flag)
+        {
+            if (0xFF == c)
+            {
+                cnt_0xff++;                    
+                if (cnt_0xff >= 3)
+                {
+                    m_lastReturnCode = NEX_RET_CMD_FINISHED_OK;
+                    ret = true;
+                }
+            }
+            else
+            {
+                chunk[chunk_len++] = (char)c;
+            }
+            if(chunk_len == NEX_STRING_CHUNK_SIZE || (ret && chunk_len))
+            {
+                chunk[chunk_len] = 0;
+                sink(chunk, chunk_len, ptr);
+                str_len += chunk_len;
+                chunk_len = 0;
+            }
+        }
+        else if (NEX_RET_STRING_HEAD == c)
+        {
+            str_start_flag = true;
+        }
+    }
+    NEX_LOG_DEBUG(NEX_LOG_RECV_STRING, str_len);
+
+    return ret;
+}
+
+/*
+ * Receive string data. 
+ * 
+ * @param str - save string data. 
+ * @param timeout - set timeout time. 
+ * @param start_flag - is str start flag (0x70) expected, default falue true
+ *
+ * @retval true - success. 
+ * @retval false - failed.
+ *
+ */
+bool Nextion::recvRetString(String &str, size_t timeout, bool start_flag)
+{
+    str = "";
+    return recvRetString(stringSink, &str, timeout, start_flag);
+}
+
+/*
+ * Receive string data. 
+ * 
+ * @param buffer - save string data. 
+ * @param len - in buffer len / out saved string len excluding null char. 
+ * @param truncated - true if string did not fit to buffer. 
+ * @param timeout - set timeout time. 
+ * @param start_flag - is str start flag (0x70) expected, default falue true
+ *
+ *
+ * @retval true - success. 
+ * @retval false - failed.  
+ *
+ */
+bool Nextion::recvRetString(char *buffer, uint16_t &len, bool &truncated, size_t timeout, bool start_flag)
+{
+    nexBufferSink sink{buffer, len, 0, false};
+    bool ret = recvRetString(bufferSink, &sink, timeout, start_flag);
+
+    if(ret && len)
+    {
+        len = sink.len;
+        if(len < sink.size)
+        {
+            buffer[len] = 0;
+        }
+    }
+    truncated = sink.truncated;
+    return ret;
+}
+
+/*
+ * Receive string data. 
+ * 
+ * @param buffer - save string data. 
+ * @param len - in buffer len / out saved string len excluding null char. 
+ * @param timeout - set timeout time. 
+ * @param start_flag - is str start flag (0x70) expected, default falue true
+ *
+ *
+ * @retval true - success. 
+ * @retval false - failed.  
+ *
+ */
+bool Nextion::recvRetString(char *buffer, uint16_t &len, size_t timeout, bool start_flag)
+{
+    bool truncated;
+    return recvRetString(buffer, len, truncated, timeout, start_flag);
+}
+
+/*
+ * Send command to Nextion.
+ *
+ * @param cmd - the string of command.
+ */
+void Nextion::sendCommand(const char* cmd)
+{
+    if(!m_commandQueueSending && IsAssignmentQueued(cmd))
+    {
+        // posted value sent later would overwrite this one
+        flushCommands();
+    }
+    // earlier replies are not for this command, queued events are kept
+    DiscardReplies();
+    // there are no sequence numbers in replies, reply of abandoned request not received by now
+    // can not be told from reply of this command, it is considered lost
+    m_abandonedHead = 0;
+    m_abandonedCount = 0;
+    ++m_requestSeq;
+    NEX_LOG_DEBUG(NEX_LOG_SEND_COMMAND, m_requestSeq);
+
+    if(cmd != m_retryCommand)
+    {
+        // store idempotent command for retry
+        m_retryCommandClass = classifyCommand(cmd);
+        if(m_retryCommandClass == NEX_CMD_NON_IDEMPOTENT || strlen(cmd) >= sizeof(m_retryCommand))
+        {
+            m_retryCommandClass = NEX_CMD_NON_IDEMPOTENT;
+            m_retryCommand[0] = 0;
+        }
+        else
+        {
+            strcpy(m_retryCommand, cmd);
+        }
+    }
+    
+    m_nexSerial->print(cmd);
+    m_nexSerial->write(0xFF);
+    m_nexSerial->write(0xFF);
+    m_nexSerial->write(0xFF);
+}
+
+#ifdef ESP8266
+void Nextion::sendRawData(const std::vector<uint8_t> &data)
+{
+    m_nexSerial->write(data.data(),data.size());
+}
+#endif
+
+void Nextion::sendRawData(const uint8_t *buf, uint16_t len)
+{
+    m_nexSerial->write(buf, len);
+}
+
+void Nextion::sendRawData(NexSpan<const uint8_t> data)
+{
+    m_nexSerial->write(data.data(), data.size());
+}
+
+void Nextion::sendRawByte(const uint8_t byte)
+{
+    m_nexSerial->write(&byte, 1);
+}
+
+size_t Nextion::SampleRxLevel()
+{
+    size_t avail{(size_t)m_nexSerial->available()};
+    if(avail > m_rxHighWater)
+    {
+        m_rxHighWater = avail;
+    }
+    // ring buffer of serial port holds at most size - 1 bytes
+    if(avail + 1 >= m_config.serialRxBufferSize)
+    {
+        if(!m_rxFull)
+        {
+            // bytes received after this are lost
+            m_rxFull = true;
+            ++m_rxFullSamples;
+        }
+    }
+    else if(!avail && !m_rxCount)
+    {
+        // data received while buffer was full is handled, later frame errors are not overflows
+        m_rxFull = false;
+    }
+    return avail;
+}
+
+void Nextion::FrameError()
+{
+    ++m_frameErrors;
+    ++m_linkErrors;
+    if(m_rxFull)
+    {
+        ++m_overflowSuspects;
+        m_rxFull = false;
+    }
+}
+
+void Nextion::setConfig(const NexInstanceConfig &config)
+{
+    bool ackChanged{config.ackMode != m_config.ackMode};
+    m_config = config;
+    // capacities can not exceed buffers or cut queued data
+    m_config.commandQueueSize = min(max(config.commandQueueSize, m_commandQueueLen), (uint16_t)sizeof(m_commandQueue));
+    m_config.eventBufferSize = min(max(config.eventBufferSize, max(m_eventBufferLen, m_eventBufferEnd)), (uint16_t)sizeof(m_eventBuffer));
+    setSerialRxBufferSize(config.serialRxBufferSize);
+    if(ackChanged && m_initState == NEX_INIT_DONE)
+    {
+        sendCommand(m_config.ackMode == NEX_ACK_FAILURES ? "bkcmd=2" : "bkcmd=3");
+        recvRetCommandFinished();
+    }
+}
+
+const NexInstanceConfig &Nextion::GetConfig() const
+{
+    return m_config;
+}
+
+void Nextion::setSerialRxBufferSize(uint16_t size)
+{
+    m_config.serialRxBufferSize = size;
+}
+
+uint16_t Nextion::GetRxHighWaterMark() const
+{
+    return m_rxHighWater;
+}
+
+uint32_t Nextion::GetRxFullCount() const
+{
+    return m_rxFullSamples;
+}
+
+uint32_t Nextion::GetFrameErrorCount() const
+{
+    return m_frameErrors;
+}
+
+uint32_t Nextion::GetRxOverflowSuspectCount() const
+{
+    return m_overflowSuspects;
+}
+
+uint32_t Nextion::GetMaxServiceInterval() const
+{
+    return m_maxServiceInterval;
+}
+
+uint32_t Nextion::GetRecommendedServiceInterval() const
+{
+    // 10 bits per byte, half of buffer fill time as margin
+    return (uint32_t)m_config.serialRxBufferSize * 10000 / m_baud / 2;
+}
+
+uint32_t Nextion::GetCurrentEventTime() const
+{
+    return m_eventTime;
+}
+
+uint32_t Nextion::GetEventCount() const
+{
+    return m_eventCount;
+}
+
+uint32_t Nextion::GetEventQueueDelayAverage() const
+{
+    return m_eventDelaySumCount ? m_eventDelaySum / m_eventDelaySumCount : 0;
+}
+
+uint32_t Nextion::GetEventQueueDelayMax() const
+{
+    return m_eventDelayMax;
+}
+
+uint32_t Nextion::GetEventHandlerTimeMax() const
+{
+    return m_eventHandlerMax;
+}
+
+void Nextion::resetEventStatistics()
+{
+    m_eventCount = 0;
+    m_eventDelaySum = 0;
+    m_eventDelaySumCount = 0;
+    m_eventDelayMax = 0;
+    m_eventHandlerMax = 0;
+}
+
+void Nextion::EventStarted(const NexEventFrame &frame, uint32_t now)
+{
+    uint32_t delay{now - frame.time()};
+    m_eventTime = frame.time();
+    ++m_eventCount;
+    if(delay > m_eventDelayMax)
+    {
+        m_eventDelayMax = delay;
+    }
+    if(m_eventDelaySum + delay < m_eventDelaySum)
+    {
+        // keep average, halve history
+        m_eventDelaySum /= 2;
+        m_eventDelaySumCount /= 2;
+    }
+    m_eventDelaySum += delay;
+    ++m_eventDelaySumCount;
+}
+
+void Nextion::resetRxStatistics()
+{
+    m_rxHighWater = 0;
+    m_rxFull = false;
+    m_rxFullSamples = 0;
+    m_frameErrors = 0;
+    m_overflowSuspects = 0;
+    m_maxServiceInterval = 0;
+    m_lastServiceTime = 0;
+}
+
+size_t Nextion::RxFill()
+{
+    size_t avail{SampleRxLevel()};
+    while(avail && m_rxCount < sizeof(m_rxBuffer))
+    {
+        uint16_t tail = (m_rxHead + m_rxCount) % sizeof(m_rxBuffer);
+        size_t chunk = min(avail, sizeof(m_rxBuffer) - m_rxCount);
+        chunk = min(chunk, (size_t)(sizeof(m_rxBuffer) - tail));
+        chunk = m_nexSerial->readBytes(&m_rxBuffer[tail], chunk);
+        if(!chunk)
+        {
+            break;
+        }
+        m_rxCount += chunk;
+        avail -= chunk;
+    }
+    return m_rxCount;
+}
+
+int Nextion::RxPeek()
+{
+    if(!m_rxCount && !RxFill())
+    {
+        return -1;
+    }
+    return m_rxBuffer[m_rxHead];
+}
+
+int Nextion::RxRead()
+{
+    int c = RxPeek();
+    if(c >= 0)
+    {
+        m_rxHead = (m_rxHead + 1) % sizeof(m_rxBuffer);
+        --m_rxCount;
+    }
+    return c;
+}
+
+int Nextion::RxPeekAt(uint8_t offset)
+{
+    uint32_t start{millis()};
+    while(RxFill() <= offset)
+    {
+        if(!WaitForData(start, 20))
+        {
+            return -1;
+        }
+    }
+    return m_rxBuffer[(m_rxHead + offset) % sizeof(m_rxBuffer)];
+}
+
+size_t Nextion::RxAvailable()
+{
+    return m_rxCount + m_nexSerial->available();
+}
+
+bool Nextion::WaitForData(uint32_t start, size_t timeout)
+{
+    uint32_t elapsed{millis()-start};
+    if(elapsed >= timeout)
+    {
+        return false;
+    }
+    uint32_t waitStart{micros()};
+    if(waitForDataCallback!=nullptr)
+    {
+        waitForDataCallback(timeout - elapsed);
+    }
+    else
+    {
+        yield();
+    }
+    m_rxWaitTime += micros() - waitStart;
+    return true;
+}
+
+uint32_t Nextion::GetReceiveWaitTime() const
+{
+    return m_rxWaitTime;
+}
+
+size_t Nextion::readBytes(uint8_t* buffer, size_t size, size_t timeout)
+{
+    timeout = resolveTimeout(timeout, m_config.returnTimeout);
+    uint32_t start{millis()};
+    size_t read{0};
+    while(read < size)
+    {
+        if(m_rxCount)
+        {
+            // staged bytes first
+            size_t chunk = min(size - read, (size_t)m_rxCount);
+            chunk = min(chunk, (size_t)(sizeof(m_rxBuffer) - m_rxHead));
+            memcpy(&buffer[read], &m_rxBuffer[m_rxHead], chunk);
+            m_rxHead = (m_rxHead + chunk) % sizeof(m_rxBuffer);
+            m_rxCount -= chunk;
+            read += chunk;
+            continue;
+        }
+        size_t avail{(size_t)m_nexSerial->available()};
+        if(avail)
+        {
+            read += m_nexSerial->readBytes(&buffer[read], min(avail, size - read));
+            continue;
+        }
+        if(!WaitForData(start, timeout))
+        {
+            break;
+        }
+    }
+    return read;
+}
+
+bool Nextion::SkipReplyFrame(uint8_t header)
+{
+    int len = replyLength(header);
+    if(len > 0)
+    {
+        uint8_t temp[8];
+        return readBytes(temp, len, m_config.returnTimeout) == (size_t)len;
+    }
+    // string, read until terminator
+    uint8_t cnt_0xff{0};
+    uint8_t c;
+    while(cnt_0xff < 3)
+    {
+        if(readBytes(&c, 1, m_config.returnTimeout) != 1)
+        {
+            return false;
+        }
+        cnt_0xff = (c == 0xFF) ? cnt_0xff + 1 : 0;
+    }
+    return true;
+}
+
+void Nextion::AbandonRequest(uint8_t expected)
+{
+    if(m_abandonedCount >= NEX_MAX_ABANDONED_REQUESTS)
+    {
+        // oldest reply is considered lost
+        m_abandonedHead = (m_abandonedHead + 1) % NEX_MAX_ABANDONED_REQUESTS;
+        --m_abandonedCount;
+    }
+    nexAbandonedRequest &request = m_abandoned[(m_abandonedHead + m_abandonedCount) % NEX_MAX_ABANDONED_REQUESTS];
+    request.seq = m_requestSeq;
+    request.expected = expected;
+    request.time = millis();
+    ++m_abandonedCount;
+    ++m_linkErrors;
+    NEX_LOG_WARNING(NEX_LOG_REQUEST_ABANDONED, m_requestSeq);
+}
+
+bool Nextion::DiscardLateReply(uint8_t header)
+{
+    uint32_t now{millis()};
+    while(m_abandonedCount)
+    {
+        // Nextion replies in command order, so the reply belongs to the oldest abandoned request
+        const nexAbandonedRequest &request = m_abandoned[m_abandonedHead];
+        m_abandonedHead = (m_abandonedHead + 1) % NEX_MAX_ABANDONED_REQUESTS;
+        --m_abandonedCount;
+        if((now - request.time) > NEX_TIMEOUT_LATE_REPLY)
+        {
+            // reply is considered lost
+            continue;
+        }
+        if(header == request.expected || isErrorReply(header))
+        {
+            NEX_LOG_INFO(NEX_LOG_LATE_REPLY, request.seq);
+            ++m_lateReplies;
+            SkipReplyFrame(header);
+            return true;
+        }
+        // reply of other type, abandoned request reply is lost
+    }
+    return false;
+}
+
+void Nextion::DiscardReplies()
+{
+    // event frame waiting for room in event buffer stops discarding, replies after it are discarded later
+    while(!ReadQueuedEvents())
+    {
+        int c = RxPeek();
+        if(c < 0)
+        {
+            break;
+        }
+        if(replyLength(c) < 0)
+        {
+            Resync();
+        }
+        else if(!DiscardLateReply(c))
+        {
+            NEX_LOG_WARNING(NEX_LOG_UNEXPECTED_REPLY, c);
+            ++m_unexpectedReplies;
+            SkipReplyFrame(c);
+        }
+        yield();
+    }
+}
+
+void Nextion::Resync()
+{
+    // skip to the next frame terminator, frames after it are kept
+    uint8_t cnt_0xff{0};
+    uint8_t c;
+    uint16_t skipped{0};
+    ++m_resyncCount;
+    while(cnt_0xff < 3 && readBytes(&c, 1, NEX_TIMEOUT_RESYNC) == 1)
+    {
+        ++skipped;
+        cnt_0xff = (c == 0xFF) ? cnt_0xff + 1 : 0;
+    }
+    m_skippedBytes += skipped;
+    FrameError();
+    NEX_LOG_WARNING(NEX_LOG_RESYNC, skipped);
+}
+
+uint32_t Nextion::GetSkippedByteCount() const
+{
+    return m_skippedBytes;
+}
+
+uint32_t Nextion::GetResyncCount() const
+{
+    return m_resyncCount;
+}
+
+int Nextion::WaitReplyHeader(uint8_t expected, uint32_t start, size_t timeout)
+{
+    while(true)
+    {
+        if(ReadQueuedEvents())
+        {
+            // reply is behind event frame which waits for room in event buffer,
+            // the room is not released until the running event handler returns
+            return -1;
+        }
+        int c = RxPeek();
+        if(c >= 0)
+        {
+            if(replyLength(c) < 0)
+            {
+                // not an event or reply frame
+                Resync();
+                continue;
+            }
+            if(c == expected || isErrorReply(c))
+            {
+                return c;
+            }
+            // reply to a command which reply was not read
+            ++m_unexpectedReplies;
+            SkipReplyFrame(c);
+            continue;
+        }
+        if(!WaitForData(start, timeout))
+        {
+            return -1;
+        }
+    }
+}
+
+size_t Nextion::RecvReply(uint8_t expected, uint8_t *buffer, size_t size, size_t timeout)
+{
+    uint32_t start{millis()};
+    int header = WaitReplyHeader(expected, start, timeout);
+    if(header < 0)
+    {
+        m_lastReturnCode = NEX_RET_NO_REPLY;
+        AbandonRequest(expected);
+        return 0;
+    }
+    int len = replyLength(header);
+    if(len <= 0 || (size_t)len > size)
+    {
+        len = size;
+    }
+    uint32_t elapsed{millis()-start};
+    size_t read = readBytes(buffer, len, elapsed < timeout ? timeout - elapsed : 0);
+    if(read < (size_t)len)
+    {
+        m_lastReturnCode = NEX_RET_NO_REPLY;
+    }
+    else
+    {
+        m_lastReturnCode = (header == expected) ? NEX_RET_CMD_FINISHED_OK : header;
+    }
+    return read;
+}
+
+bool Nextion::RetryCommand(uint8_t &attempt, uint32_t start)
+{
+    if(m_retryCommandClass == NEX_CMD_NON_IDEMPOTENT || !isRetryableCode(m_lastReturnCode))
+    {
+        return false;
+    }
+    const NexRetryPolicy &policy = m_retryPolicy[m_retryCommandClass];
+    if(attempt >= policy.maxRetries)
+    {
+        return false;
+    }
+    uint32_t backoff = (uint32_t)policy.backoff << attempt;
+    if(backoff > policy.maxBackoff)
+    {
+        backoff = policy.maxBackoff;
+    }
+    if((millis() - start) + backoff >= policy.deadline)
+    {
+        return false;
+    }
+    ++attempt;
+
+    // wait backoff time, events are still queued
+    // abandoned entry is cleared at send, an open entry is the failed attempt of this command
+    bool abandoned{m_abandonedCount != 0};
+    uint32_t backoffStart{millis()};
+    while(WaitForData(backoffStart, backoff))
+    {
+        if(!ReadQueuedEvents() && abandoned && RxPeek() >= 0)
+        {
+            // late reply of the failed attempt answers the request, command is not resent
+            // so that no second reply is left open
+            --m_abandonedCount;
+            return true;
+        }
+    }
+    ++m_retryCount;
+    NEX_LOG_WARNING(NEX_LOG_RETRY, m_requestSeq);
+    sendCommand(m_retryCommand);
+    return true;
+}
+
+void Nextion::setRetryPolicy(NexCommandClass commandClass, const NexRetryPolicy &policy)
+{
+    if(commandClass < NEX_CMD_NON_IDEMPOTENT)
+    {
+        m_retryPolicy[commandClass] = policy;
+    }
+}
+
+uint8_t Nextion::GetLastReturnCode() const
+{
+    return m_lastReturnCode;
+}
+
+uint32_t Nextion::GetRetryCount() const
+{
+    return m_retryCount;
+}
+
+uint32_t Nextion::GetLateReplyCount() const
+{
+    return m_lateReplies;
+}
+
+uint32_t Nextion::GetUnexpectedReplyCount() const
+{
+    return m_unexpectedReplies;
+}
+
+bool Nextion::recvCommand(const uint8_t command, size_t timeout)
+{
+    timeout = resolveTimeout(timeout, m_config.commandTimeout);
+    bool ret = false;
+    uint8_t temp[4] = {0};
+    size_t bytesRead = RecvReply(command, temp, sizeof(temp), timeout);
+    if (sizeof(temp) != bytesRead)
+    {
+        NEX_LOG_ERROR(NEX_LOG_RECV_COMMAND_TIMEOUT, command);
+        ret = false;
+    }
+    else
+    {
+        if (temp[0] == command
+            && temp[1] == 0xFF
+            && temp[2] == 0xFF
+            && temp[3] == 0xFF
+            )
+        {
+            ret = true;
+        }
+        else
+        {
+            NEX_LOG_ERROR(NEX_LOG_RECV_COMMAND_ERR, temp[0]);
+        }
+    }
+    return ret;
+}
+
+bool Nextion::recvRetCommandFinished(size_t timeout)
+{
+    if(m_config.ackMode == NEX_ACK_FAILURES)
+    {
+        // success is not replied, failures are discarded as unexpected replies
+        return true;
+    }
+    timeout = resolveTimeout(timeout, m_config.commandTimeout);
+    uint32_t start{millis()};
+    uint8_t attempt{0};
+    bool ret;
+    do
+    {
+        ret = recvCommand(NEX_RET_CMD_FINISHED_OK, timeout);
+    } while (!ret && RetryCommand(attempt, start));
+    if (ret) 
+    {
+        NEX_LOG_DEBUG(NEX_LOG_COMMAND_FINISHED, 0);
+    }
+    else
+    {
+        NEX_LOG_ERROR(NEX_LOG_COMMAND_FINISHED_ERR, m_lastReturnCode);
+    }
+    return ret;
+}
+
+bool Nextion::RecvTransparendDataModeReady(size_t timeout)
+{
+    dbSerialPrintln("RecvTransparendDataModeReady requested");
+    bool ret = recvCommand(Nex_RET_TRANSPARENT_DATA_READY, resolveTimeout(timeout, m_config.transparentDataModeTimeout));
+    if (ret) 
+    {
+        dbSerialPrintln("RecvTransparendDataModeReady ok");
+    }
+    else
+    {
+        dbSerialPrintln("RecvTransparendDataModeReady err");
+    }
+    return ret;
+}
+
+bool Nextion::RecvTransparendDataModeFinished(size_t timeout)
+{
+    bool ret = recvCommand(Nex_RET_TRANSPARENT_DATA_FINISHED, timeout);
+    if (ret) 
+    {
+        dbSerialPrintln("RecvTransparendDataModeFinished ok");
+    }
+    else
+    {
+        dbSerialPrintln("RecvTransparendDataModeFinished err");
+    }
+    return ret;
+}
+
+bool Nextion::nexInit(const uint32_t baud)
+{
+    nexInitBegin(baud);
+    while(true)
+    {
+        NexInitState state = nexInitPoll();
+        if(state == NEX_INIT_DONE || state == NEX_INIT_FAILED)
+        {
+            return state == NEX_INIT_DONE;
+        }
+        yield();
+    }
+}
+
+void Nextion::nexInitBegin(const uint32_t baud)
+{
+    m_initBaud=baud ? baud : m_config.defaultBaud;
+    m_baud=m_config.defaultBaud;
+    m_initStep=0;
+    m_initState=NEX_INIT_SETUP;
+    if (m_nexSerialType==HW
+#ifdef NEX_ENABLE_SW_SERIAL
+        || m_nexSerialType==SW
+#endif
+        )
+    {
+        // try to connect first with default baud as display may have forgot set baud
+        SerialBegin(m_baud); // default baud, it is recommended that do not change defaul baud on Nextion, because it can forgot it on re-start
+        m_initState=NEX_INIT_CONNECT;
+        StartInitConnect(0);
+    }
+}
+
+void Nextion::StartInitConnect(uint32_t settle)
+{
+    m_initStep=0;
+    m_initSettle=settle;
+    m_initStart=millis();
+}
+
+int8_t Nextion::PollInitConnect()
+{
+    if(m_initStep==0)
+    {
+        SendConnect();
+        m_initStep=1;
+        m_initTime=millis();
+        return 0;
+    }
+    // display may still be changing baud during settle time, probe it repeatedly
+    bool settling{millis()-m_initStart < m_initSettle};
+    ReadQueuedEvents();
+    if(RxAvailable())
+    {
+        // reply is arriving, read it
+        if(RecvConnect())
+        {
+            return 1;
+        }
+    }
+    else if(millis()-m_initTime < (settling ? NEX_CONNECT_PROBE_TIME : m_config.returnTimeout))
+    {
+        return 0;
+    }
+    if(settling)
+    {
+        m_initStep=0;
+        return 0;
+    }
+    return -1;
+}
+
+void Nextion::InitConnected()
+{
+    if(m_initBaud!=m_config.defaultBaud || m_initBaud!=m_baud)
+    {
+        // change baud to wanted
+        char cmd[14];
+        sprintf(cmd,"baud=%lu",(unsigned long)m_initBaud);
+        sendCommand(cmd);
+        m_initState=NEX_INIT_SET_BAUD;
+        m_initStep=2;
+        m_initTime=millis();
+    }
+    else
+    {
+        m_initState=NEX_INIT_SETUP;
+        m_initStep=0;
+    }
+}
+
+NexInitState Nextion::nexInitPoll()
+{
+    switch(m_initState)
+    {
+        case NEX_INIT_CONNECT:
+        {
+            int8_t r = PollInitConnect();
+            if(r > 0)
+            {
+                InitConnected();
+            }
+            else if(r < 0)
+            {
+                m_initState=NEX_INIT_FIND_BAUD;
+                m_initBaudIndex=0;
+                SerialBegin(baudRates[m_initBaudIndex]);
+                StartInitConnect(0);
+            }
+            break;
+        }
+        case NEX_INIT_FIND_BAUD:
         {
-            c = m_nexSerial->read();
-            if (str_start_flag)
+            int8_t r = PollInitConnect();
+            if(r > 0)
+            {
+                m_baud = baudRates[m_initBaudIndex];
+                dbSerialPrint("Nextion found baud: ");
+                dbSerialPrintln(m_baud);
+                InitConnected();
+            }
+            else if(r < 0)
             {
-                if (0xFF == c)
+                if(++m_initBaudIndex >= (sizeof(baudRates)/sizeof(baudRates[0])))
                 {
-                    cnt_0xff++;                    
-                    if (cnt_0xff >= 3)
-                    {
-                        ret = true;
-                        break;
-                    }
+                    SerialBegin(m_config.defaultBaud);
+                    m_initState=NEX_INIT_FAILED;
                 }
                 else
                 {
-                    str += (char)c;
+                    SerialBegin(baudRates[m_initBaudIndex]);
+                    StartInitConnect(0);
                 }
             }
-            else if (NEX_RET_STRING_HEAD == c)
+            break;
+        }
+        case NEX_INIT_SET_BAUD:
+        {
+            if(m_initStep==2)
+            {
+                // baud command is sent with old baud before switching,
+                // connect is probed until display has changed its baud
+                m_nexSerial->flush();
+                SerialBegin(m_initBaud);
+                StartInitConnect(NEX_BAUD_SETTLE_TIME);
+                break;
+            }
+            int8_t r = PollInitConnect();
+            if(r > 0)
             {
-                str_start_flag = true;
+                m_baud=m_initBaud;
+                m_initState=NEX_INIT_SETUP;
+                m_initStep=0;
             }
-            yield();
+            else if(r < 0)
+            {
+                m_initState=NEX_INIT_FAILED;
+            }
+            break;
         }
-        delayMicroseconds(20);
-        yield();
+        case NEX_INIT_SETUP:
+        {
+            if(m_initStep==0 || m_initStep==2)
+            {
+                if(m_initStep==0)
+                {
+                    dbSerialPrint("Used Nextion baud: ");
+                    dbSerialPrintln(m_baud);
+                }
+                sendCommand(m_initStep==0 ? (m_config.ackMode == NEX_ACK_FAILURES ? "bkcmd=2" : "bkcmd=3") : "page 0");
+                ++m_initStep;
+                m_initTime=millis();
+                break;
+            }
+            ReadQueuedEvents();
+            bool timeout{millis()-m_initTime >= m_config.commandTimeout};
+            if(!RxAvailable() && !timeout && m_config.ackMode == NEX_ACK_ALL)
+            {
+                break;
+            }
+            bool ret = recvRetCommandFinished(timeout ? 0 : m_config.commandTimeout);
+            if(m_initStep==1)
+            {
+                // bkcmd result is not checked
+                ++m_initStep;
+            }
+            else
+            {
+                m_initState = ret ? NEX_INIT_DONE : NEX_INIT_FAILED;
+            }
+            break;
+        }
+        default:
+            break;
     }
-    dbSerialPrint("recvRetString[");
-    dbSerialPrint(str.length());
-    dbSerialPrint(",");
-    dbSerialPrint(str);
-    dbSerialPrintln("]");
+    return m_initState;
+}
 
-    return ret;
+NexInitState Nextion::GetInitState() const
+{
+    return m_initState;
 }
 
-/*
- * Receive string data. 
- * 
- * @param buffer - save string data. 
- * @param len - in buffer len / out saved string len excluding null char. 
- * @param timeout - set timeout time. 
- * @param start_flag - is str start flag (0x70) expected, default falue true
- *
- *
- * @retval true - success. 
- * @retval false - failed.  
- *
- */
-bool Nextion::recvRetString(char *buffer, uint16_t &len, size_t timeout, bool start_flag)
+bool Nextion::SwitchBaud(uint32_t baud)
 {
-    String temp;
-    bool ret = recvRetString(temp,timeout, start_flag);
+    char cmd[14];
+    sprintf(cmd,"baud=%lu",(unsigned long)baud);
+    sendCommand(cmd);
+    m_nexSerial->flush();
+    return ReconnectAt(baud);
+}
 
-    if(ret && len)
+bool Nextion::ReconnectAt(uint32_t baud)
+{
+    SerialBegin(baud);
+    uint32_t start{millis()};
+    do
+    {
+        // probe until display has changed its baud
+        SendConnect();
+        if(RecvConnect(NEX_CONNECT_PROBE_TIME))
+        {
+            m_baud=baud;
+            return true;
+        }
+    } while(millis()-start < NEX_BAUD_SETTLE_TIME + m_config.returnTimeout);
+    return false;
+}
+
+uint8_t Nextion::LinkTest(uint8_t rounds)
+{
+    // values with 0xFF bytes test frame terminator handling
+    static const int32_t patterns[]{0x55AA55AA, -1, 0, 0x7FFFFFFF, (int32_t)0x80FF00FF, 0x01020304, (int32_t)0xFFFFFF00, 0x00FFFFFF};
+    uint8_t errors{0};
+    uint32_t retries{m_retryCount};
+    char cmd[20];
+    for(uint8_t i{0}; i < rounds; ++i)
     {
-        len=temp.length()>len?len:temp.length();
-        strncpy(buffer,temp.c_str(), len);
+        int32_t value{patterns[i % (sizeof(patterns)/sizeof(patterns[0]))]};
+        int32_t echo{0};
+        sprintf(cmd,"sys0=%ld",(long)value);
+        sendCommand(cmd);
+        bool ok = recvRetCommandFinished();
+        sendCommand("get sys0");
+        // echo is read also after failed assignment, so its reply is not left for next round
+        bool echoed = recvRetNumber(&echo);
+        if(!ok || !echoed || echo != value)
+        {
+            ++errors;
+        }
     }
-    return ret;
+    // retried command is a link error as well
+    return errors + (m_retryCount - retries);
 }
 
-/*
- * Send command to Nextion.
- *
- * @param cmd - the string of command.
- */
-void Nextion::sendCommand(const char* cmd)
+uint32_t Nextion::calibrateBaud(uint32_t maxBaud, uint8_t rounds)
 {
-    ReadQueuedEvents();
-    // empty in buffer for clean responce
-    while (m_nexSerial->available())
+    int32_t sys0;
+    sendCommand("get sys0");
+    if(!recvRetNumber(&sys0))
     {
-        m_nexSerial->read();
+        return m_baud;
     }
-    
-    m_nexSerial->print(cmd);
-    m_nexSerial->write(0xFF);
-    m_nexSerial->write(0xFF);
-    m_nexSerial->write(0xFF);
+    char restore[20];
+    sprintf(restore,"sys0=%ld",(long)sys0);
+    m_linkMinBaud = m_baud;
+    uint32_t good{m_baud};
+    for(uint8_t i{0}; i < (sizeof(baudRates)/sizeof(baudRates[0])) && baudRates[i] <= maxBaud; ++i)
+    {
+        if(baudRates[i] <= good)
+        {
+            continue;
+        }
+        if(!SwitchBaud(baudRates[i]) || LinkTest(rounds) != 0)
+        {
+            dbSerialPrint("Nextion baud not stable: ");
+            dbSerialPrintln(baudRates[i]);
+            if(!SwitchBaud(good) && !ReconnectAt(good))
+            {
+                // display is lost at unknown baud, find it without blocking,
+                // sys0 is restored from command queue when display is found
+                nexInitBegin(good);
+                postCommand(restore);
+                return m_baud;
+            }
+            break;
+        }
+        good = baudRates[i];
+    }
+    dbSerialPrint("Nextion calibrated baud: ");
+    dbSerialPrintln(m_baud);
+
+    sendCommand(restore);
+    recvRetCommandFinished();
+
+    m_linkMonitor = true;
+    m_linkWindowErrors = m_linkErrors;
+    m_linkWindowStart = millis();
+    return m_baud;
 }
 
-#ifdef ESP8266
-void Nextion::sendRawData(const std::vector<uint8_t> &data)
+void Nextion::CheckLinkQuality()
 {
-    m_nexSerial->write(data.data(),data.size());
+    uint32_t now{millis()};
+    if(m_linkErrors - m_linkWindowErrors >= NEX_LINK_ERROR_LIMIT)
+    {
+        uint32_t lower{m_linkMinBaud};
+        for(uint8_t i{0}; i < (sizeof(baudRates)/sizeof(baudRates[0])) && baudRates[i] < m_baud; ++i)
+        {
+            if(baudRates[i] >= m_linkMinBaud)
+            {
+                lower = baudRates[i];
+            }
+        }
+        if(lower < m_baud)
+        {
+            dbSerialPrint("Nextion link errors, baud falls back to: ");
+            dbSerialPrintln(lower);
+            ++m_baudFallbacks;
+            if(!SwitchBaud(lower))
+            {
+                // find display again without blocking
+                nexInitBegin(lower);
+            }
+        }
+        m_linkWindowErrors = m_linkErrors;
+        m_linkWindowStart = now;
+    }
+    else if(now - m_linkWindowStart >= NEX_LINK_MONITOR_WINDOW)
+    {
+        m_linkWindowErrors = m_linkErrors;
+        m_linkWindowStart = now;
+    }
 }
-#endif
 
-void Nextion::sendRawData(const uint8_t *buf, uint16_t len)
+uint32_t Nextion::GetLinkErrorCount() const
 {
-    m_nexSerial->write(buf, len);
+    return m_linkErrors;
 }
 
-void Nextion::sendRawByte(const uint8_t byte)
+uint32_t Nextion::GetBaudFallbackCount() const
 {
-    m_nexSerial->write(&byte, 1);
+    return m_baudFallbacks;
 }
 
-size_t Nextion::readBytes(uint8_t* buffer, size_t size, size_t timeout)
+uint32_t Nextion::GetCurrentBaud()
 {
-    uint32_t start{millis()};
-    size_t avail{(size_t)m_nexSerial->available()};
-    while(size>avail && (millis()-start)<timeout)
-    {
-        delayMicroseconds(10);
-        yield();
-        avail=m_nexSerial->available();
-    }
-    
-    size_t read=min(size,avail);
-    for(size_t i{read}; i;--i)
-    {
-        *buffer=m_nexSerial->read();
-        ++buffer;
-    }
-    return read;
+    return m_baud;
 }
 
-bool Nextion::recvCommand(const uint8_t command, size_t timeout)
+// queued command entry: length, coalescing key length, expiry time and command
+#define NEX_COMMAND_ENTRY_HEADER 6
+
+static uint32_t commandExpiry(const uint8_t *entry)
 {
-    bool ret = false;
-    uint8_t temp[4] = {0};
-    ReadQueuedEvents();
-    size_t bytesRead = readBytes((uint8_t *)temp, sizeof(temp), timeout);
-    if (sizeof(temp) != bytesRead)
-    {
-        dbSerialPrint("recv command timeout: ");
+    uint32_t expiry;
+    memcpy(&expiry, &entry[2], sizeof(expiry));
+    return expiry;
+}
 
-        ret = false;
+static bool commandExpired(const uint8_t *entry, uint32_t now)
+{
+    uint32_t expiry = commandExpiry(entry);
+    return expiry != 0 && (int32_t)(now - expiry) > 0;
+}
+
+bool Nextion::postCommand(const char* cmd, uint32_t deadline)
+{
+    size_t len = strlen(cmd) + 1;
+    if(len > 0xFF || len + NEX_COMMAND_ENTRY_HEADER > m_config.commandQueueSize)
+    {
+        return false;
     }
-    else
+    uint32_t expiry{0};
+    if(deadline)
     {
-        if (temp[0] == command
-            && temp[1] == 0xFF
-            && temp[2] == 0xFF
-            && temp[3] == 0xFF
-            )
+        expiry = millis() + deadline;
+        if(expiry == 0)
         {
-            ret = true;
+            expiry = 1;
         }
-        else
+    }
+    uint8_t keyLen = coalescingKeyLength(cmd);
+    uint16_t found{0xFFFF};
+    if(keyLen)
+    {
+        // latest pending assignment to same attribute after last non coalescible command
+        uint16_t pos{0};
+        if(m_commandQueueSending && m_commandQueueLen)
+        {
+            // command being sent can not be replaced
+            pos = m_commandQueue[0] + NEX_COMMAND_ENTRY_HEADER;
+        }
+        for(; pos < m_commandQueueLen; pos += m_commandQueue[pos] + NEX_COMMAND_ENTRY_HEADER)
         {
-            dbSerialPrint("recv command err value: ");
-            dbSerialPrintln(temp[0]);   
+            if(m_commandQueue[pos + 1] == 0)
+            {
+                found = 0xFFFF;
+            }
+            else if(m_commandQueue[pos + 1] == keyLen &&
+                memcmp(&m_commandQueue[pos + NEX_COMMAND_ENTRY_HEADER], cmd, keyLen) == 0)
+            {
+                found = pos;
+            }
         }
     }
-    return ret;
-}
-
-bool Nextion::recvRetCommandFinished(size_t timeout)
-{
-    bool ret = recvCommand(NEX_RET_CMD_FINISHED_OK, timeout);
-    if (ret) 
+    if(found != 0xFFFF)
     {
-        dbSerialPrintln("recvRetCommandFinished ok");
+        // superseded value is replaced in place
+        uint8_t oldLen = m_commandQueue[found];
+        if(m_commandQueueLen - oldLen + len > m_config.commandQueueSize)
+        {
+            return false;
+        }
+        uint16_t tail = found + NEX_COMMAND_ENTRY_HEADER + oldLen;
+        memmove(&m_commandQueue[found + NEX_COMMAND_ENTRY_HEADER + len], &m_commandQueue[tail], m_commandQueueLen - tail);
+        m_commandQueueLen = m_commandQueueLen - oldLen + len;
+        m_commandQueue[found] = len;
+        memcpy(&m_commandQueue[found + 2], &expiry, sizeof(expiry));
+        memcpy(&m_commandQueue[found + NEX_COMMAND_ENTRY_HEADER], cmd, len);
+        ++m_coalescedCommands;
+        return true;
     }
-    else
+    if(m_commandQueueLen + len + NEX_COMMAND_ENTRY_HEADER > m_config.commandQueueSize &&
+        !(DropStaleCommands() && m_commandQueueLen + len + NEX_COMMAND_ENTRY_HEADER <= m_config.commandQueueSize))
     {
-        dbSerialPrintln("recvRetCommandFinished err");
+        return false;
     }
-    return ret;
+    uint8_t *entry = &m_commandQueue[m_commandQueueLen];
+    entry[0] = len;
+    entry[1] = keyLen;
+    memcpy(&entry[2], &expiry, sizeof(expiry));
+    memcpy(&entry[NEX_COMMAND_ENTRY_HEADER], cmd, len);
+    m_commandQueueLen += len + NEX_COMMAND_ENTRY_HEADER;
+    return true;
 }
 
-bool Nextion::RecvTransparendDataModeReady(size_t timeout)
+bool Nextion::DropStaleCommands()
 {
-    dbSerialPrintln("RecvTransparendDataModeReady requested");
-    bool ret = recvCommand(Nex_RET_TRANSPARENT_DATA_READY, timeout);
-    if (ret) 
+    uint32_t now{millis()};
+    uint16_t pos{0};
+    uint16_t out{0};
+    if(m_commandQueueSending && m_commandQueueLen)
     {
-        dbSerialPrintln("RecvTransparendDataModeReady ok");
+        // command being sent is kept
+        pos = out = m_commandQueue[0] + NEX_COMMAND_ENTRY_HEADER;
     }
-    else
+    while(pos < m_commandQueueLen)
     {
-        dbSerialPrintln("RecvTransparendDataModeReady err");
+        uint16_t entryLen = m_commandQueue[pos] + NEX_COMMAND_ENTRY_HEADER;
+        if(commandExpired(&m_commandQueue[pos], now))
+        {
+            NEX_LOG_INFO(NEX_LOG_STALE_COMMAND, m_commandQueue[pos]);
+            ++m_staleCommands;
+        }
+        else
+        {
+            if(out != pos)
+            {
+                memmove(&m_commandQueue[out], &m_commandQueue[pos], entryLen);
+            }
+            out += entryLen;
+        }
+        pos += entryLen;
     }
-    return ret;
+    m_commandQueueLen = out;
+    return out != pos;
 }
 
-bool Nextion::RecvTransparendDataModeFinished(size_t timeout)
+bool Nextion::IsAssignmentQueued(const char *cmd) const
 {
-    bool ret = recvCommand(Nex_RET_TRANSPARENT_DATA_FINISHED, timeout);
-    if (ret) 
+    const char *assign = strchr(cmd, '=');
+    if(!assign)
     {
-        dbSerialPrintln("RecvTransparendDataModeFinished ok");
+        return false;
     }
-    else
+    size_t keyLen = assign - cmd + 1;
+    for(uint16_t pos{0}; pos < m_commandQueueLen; pos += m_commandQueue[pos] + NEX_COMMAND_ENTRY_HEADER)
     {
-        dbSerialPrintln("RecvTransparendDataModeFinished err");
+        if(m_commandQueue[pos + 1] == keyLen &&
+            memcmp(&m_commandQueue[pos + NEX_COMMAND_ENTRY_HEADER], cmd, keyLen) == 0)
+        {
+            return true;
+        }
     }
-    return ret;
+    return false;
 }
 
-bool Nextion::nexInit(const uint32_t baud)
+bool Nextion::flushCommands()
 {
-    m_baud=NEX_SERIAL_DEFAULT_BAUD;
-    if (m_nexSerialType==HW)
+    if(m_commandQueueSending)
     {
-        // try to connect first with default baud as display may have forgot set baud
-        ((HardwareSerial*)m_nexSerial)->begin(m_baud); // default baud, it is recommended that do not change defaul baud on Nextion, because it can forgot it on re-start
-        if(!connect())
-        {
-            if(!findBaud(m_baud))
-            {
-                ((HardwareSerial*)m_nexSerial)->begin(NEX_SERIAL_DEFAULT_BAUD);
-                return false;
-            }
-        }
-        if(baud!=NEX_SERIAL_DEFAULT_BAUD  || baud!=m_baud)
-        {
-            // change baud to wanted
-            char cmd[14];
-            sprintf(cmd,"baud=%lu",(unsigned long)baud);
-            sendCommand(cmd);
-            delay(100);
-            ((HardwareSerial*)m_nexSerial)->begin(baud);
-            if(!connect())
-            {
-                return false;
-            }
-            m_baud=baud;
-        }
+        // called from wait callback
+        return false;
     }
-#ifdef NEX_ENABLE_SW_SERIAL   
-    if (m_nexSerialType==SW)
+    bool ret{true};
+    m_commandQueueSending = true;
+    while(m_commandQueueLen)
     {
-        // try to connect first with default baud as daspaly may have forgot set baud
-        ((SoftwareSerial*)m_nexSerial)->begin(m_baud); // default baud, it is recommended that do not change defaul baud on Nextion, because it can forgot it on re-start
-        if(!connect())
+        if(commandExpired(m_commandQueue, millis()))
         {
-            if(!findBaud(m_baud))
-            {
-                ((SoftwareSerial*)m_nexSerial)->begin(NEX_SERIAL_DEFAULT_BAUD);
-                return false;
-            }
+            // stale value is worse than no value, it delays current data
+            NEX_LOG_INFO(NEX_LOG_STALE_COMMAND, m_commandQueue[0]);
+            ++m_staleCommands;
         }
-        if(baud!=NEX_SERIAL_DEFAULT_BAUD || baud!=m_baud)
+        else
         {
-            // change baud to wanted
-            char cmd[14];
-            sprintf(cmd,"baud=%lu",(unsigned long)baud);
-            sendCommand(cmd);
-            delay(100);
-            ((SoftwareSerial*)m_nexSerial)->begin(baud);
-            if(!connect())
+            sendCommand(reinterpret_cast<const char*>(&m_commandQueue[NEX_COMMAND_ENTRY_HEADER]));
+            if(!recvRetCommandFinished())
             {
-                return false;
+                ++m_failedPostedCommands;
+                ret = false;
             }
-            m_baud=baud;
         }
-    } 
-#endif
-    dbSerialPrint("Used Nextion baud: ");
-    dbSerialPrintln(m_baud);
-    sendCommand("bkcmd=3");
-    recvRetCommandFinished();
-    sendCommand("page 0");
-    bool ret = recvRetCommandFinished();
+        uint16_t entryLen = m_commandQueue[0] + NEX_COMMAND_ENTRY_HEADER;
+        m_commandQueueLen -= entryLen;
+        memmove(m_commandQueue, &m_commandQueue[entryLen], m_commandQueueLen);
+    }
+    m_commandQueueSending = false;
     return ret;
 }
 
-uint32_t Nextion::GetCurrentBaud()
+uint32_t Nextion::GetCoalescedCommandCount() const
 {
-    return m_baud;
+    return m_coalescedCommands;
+}
+
+uint32_t Nextion::GetFailedPostedCommandCount() const
+{
+    return m_failedPostedCommands;
+}
+
+uint32_t Nextion::GetStaleCommandCount() const
+{
+    return m_staleCommands;
 }
 
 void Nextion::nexLoop(NexTouch *nex_listen_list[])
 {
+    uint32_t now{millis()};
+    if(m_lastServiceTime && now - m_lastServiceTime > m_maxServiceInterval)
+    {
+        m_maxServiceInterval = now - m_lastServiceTime;
+    }
+    m_lastServiceTime = now;
+    SampleRxLevel();
+
+    bool initializing{m_initState > NEX_INIT_IDLE && m_initState < NEX_INIT_DONE};
+    if(initializing)
+    {
+        nexInitPoll();
+    }
+    else if(m_linkMonitor)
+    {
+        CheckLinkQuality();
+    }
+
     ReadQueuedEvents();
-    for(nexQueuedEvent* queued = GetQueuedEvent(); queued; queued = GetQueuedEvent())
+    NexEventFrame frame;
+    while(GetQueuedEvent(frame))
     {
-        uint8_t *__buffer{queued->event_data};
+        uint32_t handleStart{micros()};
+        EventStarted(frame, handleStart);
+        if(frame.length() >= 4 && !frame.isTerminated() && !FindCustomEvent(frame.header()))
+        {
+            FrameError();
+        }
+        NEX_LOG_DEBUG(NEX_LOG_EVENT, frame.header());
+        if(eventFrameCallback!=nullptr)
+        {
+            eventFrameCallback(frame);
+        }
 
-        switch(__buffer[0])
+        switch(frame.header())
         {
             case NEX_RET_EVENT_NEXTION_STARTUP:
             {
-                if (0x00 == __buffer[1] && 0x00 == __buffer[2] && 0xFF == __buffer[3] && 0xFF == __buffer[4] && 0xFF == __buffer[5])
+                if (0x00 == frame[1] && 0x00 == frame[2] && frame.isTerminated())
                 {
                     if(nextionStartupCallback!=nullptr)
                     {
@@ -644,19 +2066,19 @@ void Nextion::nexLoop(NexTouch *nex_listen_list[])
             }
             case NEX_RET_EVENT_TOUCH_HEAD:
             {
-                if (0xFF == __buffer[4] && 0xFF == __buffer[5] && 0xFF == __buffer[6])
+                if (frame.isTerminated())
                 {
-                    NexTouch::iterate(nex_listen_list, __buffer[1], __buffer[2], __buffer[3]);
+                    NexTouch::iterate(nex_listen_list, frame.pageId(), frame.componentId(), frame.touchEvent());
                 }
                 break;
             }
             case NEX_RET_CURRENT_PAGE_ID_HEAD:
             {
-                if (0xFF == __buffer[2] && 0xFF == __buffer[3] && 0xFF == __buffer[4])
+                if (frame.isTerminated())
                 {
                     if(currentPageIdCallback!=nullptr)
                     {
-                        currentPageIdCallback(__buffer[1]);
+                        currentPageIdCallback(frame.pageId());
                     }
                 }
                 break;
@@ -664,17 +2086,22 @@ void Nextion::nexLoop(NexTouch *nex_listen_list[])
             case NEX_RET_EVENT_POSITION_HEAD:
             case NEX_RET_EVENT_SLEEP_POSITION_HEAD:
             {
-                if (0xFF == __buffer[6] && 0xFF == __buffer[7] && 0xFF == __buffer[8])
+                if (frame.isTerminated())
                 {
-                    if(__buffer[0] == NEX_RET_EVENT_POSITION_HEAD && touchCoordinateCallback!=nullptr)
+                    if(frame.header() == NEX_RET_EVENT_POSITION_HEAD)
                     {
-                            
-                        touchCoordinateCallback(((int16_t)__buffer[2] << 8) | (__buffer[1]), ((int16_t)__buffer[4] << 8) | (__buffer[3]),__buffer[5]);
+                        if(touchCoordinateCallback!=nullptr)
+                        {
+                            touchCoordinateCallback(frame.x(), frame.y(), frame.touchEvent());
+                        }
+                        for(NexCoordinateListener *l = m_coordinateListeners; l; l = l->m_nextCoordinateListener)
+                        {
+                            l->touchCoordinate(frame.x(), frame.y(), frame.touchEvent(), frame.time());
+                        }
                     }
-                    else if(__buffer[0] == NEX_RET_EVENT_SLEEP_POSITION_HEAD && touchCoordinateCallback!=nullptr)
+                    else if(frame.header() == NEX_RET_EVENT_SLEEP_POSITION_HEAD && touchEventInSleepModeCallback!=nullptr)
                     {
-                            
-                        touchEventInSleepModeCallback(((int16_t)__buffer[2] << 8) | (__buffer[1]), ((int16_t)__buffer[4] << 8) | (__buffer[3]),__buffer[5]);
+                        touchEventInSleepModeCallback(frame.x(), frame.y(), frame.touchEvent());
                     }
                 }
                 break;
@@ -682,13 +2109,13 @@ void Nextion::nexLoop(NexTouch *nex_listen_list[])
             case NEX_RET_AUTOMATIC_SLEEP:
             case NEX_RET_AUTOMATIC_WAKE_UP:
             {
-                if (0xFF == __buffer[1] && 0xFF == __buffer[2] && 0xFF == __buffer[3])
+                if (frame.isTerminated())
                 {
-                    if(__buffer[0]==NEX_RET_AUTOMATIC_SLEEP && automaticSleepCallback!=nullptr)
+                    if(frame.header()==NEX_RET_AUTOMATIC_SLEEP && automaticSleepCallback!=nullptr)
                     {
                         automaticSleepCallback();
                     }
-                    else if(__buffer[0]==NEX_RET_AUTOMATIC_WAKE_UP && automaticWakeUpCallback!=nullptr)
+                    else if(frame.header()==NEX_RET_AUTOMATIC_WAKE_UP && automaticWakeUpCallback!=nullptr)
                     {
                         automaticWakeUpCallback();
                     }
@@ -711,31 +2138,56 @@ void Nextion::nexLoop(NexTouch *nex_listen_list[])
                 }
                 break;
             }
+            case NEX_RET_VALUE_CHANGE_HEAD:
+            {
+                if (frame.isTerminated())
+                {
+                    NexTouch::iterateValueChange(nex_listen_list, frame.pageId(), frame.componentId(), frame.value());
+                }
+                break;
+            }
             default:
             {
+                const nexCustomEvent *custom = FindCustomEvent(frame.header());
+                if(custom)
+                {
+                    custom->callback(frame, custom->ptr);
+                }
                 break;              
             }
         }; 
-        delete queued;
+        uint32_t handleTime{micros() - handleStart};
+        if(handleTime > m_eventHandlerMax)
+        {
+            m_eventHandlerMax = handleTime;
+        }
         ReadQueuedEvents();    
     }
 
-    if(m_nexSerial->available())
+    if(m_coordinateListeners)
     {
-        ReadQueuedEvents();
-        if(!m_queuedEvents)
+        uint32_t time{micros()};
+        for(NexCoordinateListener *l = m_coordinateListeners; l; l = l->m_nextCoordinateListener)
         {
-            // unnoun data clean buffer.
-            uint8_t c = m_nexSerial->read();
-            dbSerialPrint("Unexpected data received hex: ");
-            while (m_nexSerial->available())
-            {
-                dbSerialPrint(c);
-                dbSerialPrint(',');
-                c=m_nexSerial->read();
-                yield();
-            }
-            dbSerialPrintln(c);
+            l->poll(time);
         }
+    }
+
+    if(m_timerWheel)
+    {
+        m_timerWheel->poll();
+    }
+
+    if(RxAvailable() && !initializing)
+    {
+        // late replies and replies which are not read,
+        // during initialization reply of the current step is read by nexInitPoll
+        DiscardReplies();
     } 
+
+    if(m_initState == NEX_INIT_IDLE || m_initState == NEX_INIT_DONE)
+    {
+        // queued commands are kept until display is initialized
+        flushCommands();
+    }
 }
@@ -0,0 +1,195 @@
+/**
+ * @file NexHotspotGrid.cpp
+ *
+ * The implementation of class NexHotspotGrid. 
+ *
+ * @author Enhanced-Nextion-Library contributors 10/18/2026
+ * 
+ * @copyright 2026 Enhanced-Nextion-Library contributors
+ */
+
+#include "NexHotspotGrid.h"
+
+#define NEX_NO_LINK (0xFFFF)
+
+NexHotspotGrid::NexHotspotGrid(Nextion *nextion, uint16_t width, uint16_t height)
+    :m_nextion{nextion},
+    m_cellWidth{(uint16_t)((width + NEX_HOTSPOT_GRID_COLUMNS - 1) / NEX_HOTSPOT_GRID_COLUMNS)},
+    m_cellHeight{(uint16_t)((height + NEX_HOTSPOT_GRID_ROWS - 1) / NEX_HOTSPOT_GRID_ROWS)}
+{
+    if(!m_cellWidth)
+    {
+        m_cellWidth = 1;
+    }
+    if(!m_cellHeight)
+    {
+        m_cellHeight = 1;
+    }
+    clear();
+    nextion->addCoordinateListener(this);
+}
+
+NexHotspotGrid::~NexHotspotGrid()
+{
+    m_nextion->removeCoordinateListener(this);
+}
+
+void NexHotspotGrid::clear()
+{
+    for(uint16_t i{0}; i < NEX_HOTSPOT_GRID_ROWS * NEX_HOTSPOT_GRID_COLUMNS; ++i)
+    {
+        m_cells[i] = NEX_NO_LINK;
+    }
+    for(uint16_t i{0}; i < NEX_HOTSPOT_LINKS; ++i)
+    {
+        m_links[i].hotspot = nullptr;
+        m_links[i].next = i + 1 < NEX_HOTSPOT_LINKS ? i + 1 : NEX_NO_LINK;
+    }
+    m_free = 0;
+    m_freeCount = NEX_HOTSPOT_LINKS;
+    m_pressed = nullptr;
+    m_down = false;
+}
+
+bool NexHotspotGrid::Cells(const NexVirtualHotspot *hotspot, uint8_t &c0, uint8_t &r0, uint8_t &c1, uint8_t &r1) const
+{
+    if(!hotspot->w || !hotspot->h)
+    {
+        return false;
+    }
+    uint16_t c{(uint16_t)(hotspot->x / m_cellWidth)};
+    uint16_t r{(uint16_t)(hotspot->y / m_cellHeight)};
+    if(c >= NEX_HOTSPOT_GRID_COLUMNS || r >= NEX_HOTSPOT_GRID_ROWS)
+    {
+        // outside of screen
+        return false;
+    }
+    c0 = c;
+    r0 = r;
+    c = (hotspot->x + (uint32_t)hotspot->w - 1) / m_cellWidth;
+    r = (hotspot->y + (uint32_t)hotspot->h - 1) / m_cellHeight;
+    c1 = c < NEX_HOTSPOT_GRID_COLUMNS ? c : NEX_HOTSPOT_GRID_COLUMNS - 1;
+    r1 = r < NEX_HOTSPOT_GRID_ROWS ? r : NEX_HOTSPOT_GRID_ROWS - 1;
+    return true;
+}
+
+bool NexHotspotGrid::add(NexVirtualHotspot *hotspot)
+{
+    uint8_t c0, r0, c1, r1;
+    if(!Cells(hotspot, c0, r0, c1, r1) || (uint16_t)(c1 - c0 + 1) * (r1 - r0 + 1) > m_freeCount)
+    {
+        return false;
+    }
+    for(uint16_t link = m_cells[hotspot->r0 * NEX_HOTSPOT_GRID_COLUMNS + hotspot->c0]; link != NEX_NO_LINK; link = m_links[link].next)
+    {
+        if(m_links[link].hotspot == hotspot)
+        {
+            // already added
+            return false;
+        }
+    }
+    hotspot->c0 = c0;
+    hotspot->r0 = r0;
+    hotspot->c1 = c1;
+    hotspot->r1 = r1;
+    for(uint8_t r{r0}; r <= r1; ++r)
+    {
+        for(uint8_t c{c0}; c <= c1; ++c)
+        {
+            // prepend, last added is found first
+            uint16_t link{m_free};
+            m_free = m_links[link].next;
+            --m_freeCount;
+            uint16_t &cell = m_cells[r * NEX_HOTSPOT_GRID_COLUMNS + c];
+            m_links[link].hotspot = hotspot;
+            m_links[link].next = cell;
+            cell = link;
+        }
+    }
+    return true;
+}
+
+bool NexHotspotGrid::remove(NexVirtualHotspot *hotspot)
+{
+    bool removed{false};
+    // cells stored by add, geometry may have changed since
+    for(uint8_t r{hotspot->r0}; r <= hotspot->r1; ++r)
+    {
+        for(uint8_t c{hotspot->c0}; c <= hotspot->c1; ++c)
+        {
+            for(uint16_t *link = &m_cells[r * NEX_HOTSPOT_GRID_COLUMNS + c]; *link != NEX_NO_LINK; link = &m_links[*link].next)
+            {
+                if(m_links[*link].hotspot == hotspot)
+                {
+                    uint16_t freed{*link};
+                    *link = m_links[freed].next;
+                    m_links[freed].hotspot = nullptr;
+                    m_links[freed].next = m_free;
+                    m_free = freed;
+                    ++m_freeCount;
+                    removed = true;
+                    break;
+                }
+            }
+        }
+    }
+    if(m_pressed == hotspot)
+    {
+        m_pressed = nullptr;
+    }
+    return removed;
+}
+
+NexVirtualHotspot *NexHotspotGrid::hitTest(uint16_t x, uint16_t y) const
+{
+    uint16_t c{(uint16_t)(x / m_cellWidth)};
+    uint16_t r{(uint16_t)(y / m_cellHeight)};
+    if(c >= NEX_HOTSPOT_GRID_COLUMNS || r >= NEX_HOTSPOT_GRID_ROWS)
+    {
+        return nullptr;
+    }
+    for(uint16_t link = m_cells[r * NEX_HOTSPOT_GRID_COLUMNS + c]; link != NEX_NO_LINK; link = m_links[link].next)
+    {
+        NexVirtualHotspot *hotspot = m_links[link].hotspot;
+        if(x >= hotspot->x && x - hotspot->x < hotspot->w && y >= hotspot->y && y - hotspot->y < hotspot->h)
+        {
+            return hotspot;
+        }
+    }
+    return nullptr;
+}
+
+uint16_t NexHotspotGrid::GetFreeLinkCount() const
+{
+    return m_freeCount;
+}
+
+void NexHotspotGrid::touchCoordinate(uint16_t x, uint16_t y, uint8_t event, uint32_t /*time*/)
+{
+    if(event == NEX_EVENT_PUSH)
+    {
+        if(m_down)
+        {
+            // move sample of current touch
+            return;
+        }
+        m_down = true;
+        m_pressed = hitTest(x, y);
+        if(m_pressed && m_pressed->push)
+        {
+            m_pressed->push(m_pressed->ptr);
+        }
+        return;
+    }
+    m_down = false;
+    if(m_pressed)
+    {
+        // release goes to the pressed region like Nextion pop event
+        NexVirtualHotspot *pressed = m_pressed;
+        m_pressed = nullptr;
+        if(pressed->pop)
+        {
+            pressed->pop(pressed->ptr);
+        }
+    }
+}
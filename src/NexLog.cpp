@@ -0,0 +1,71 @@
+/**
+ * @file NexLog.cpp
+ *
+ * The implementation of binary log ring buffer. 
+ *
+ * @author Enhanced-Nextion-Library contributors 10/18/2026
+ * 
+ * @copyright 2026 Enhanced-Nextion-Library contributors
+ */
+#include "NexLog.h"
+
+#if NEX_LOG_LEVEL > NEX_LOG_LEVEL_OFF
+
+#define NEX_LOG_RECORD_SIZE 9
+#define NEX_LOG_FORMAT_VERSION 1
+
+static uint8_t _log_buffer[NEX_LOG_BUFFER_RECORDS][NEX_LOG_RECORD_SIZE];
+static uint16_t _log_head{0};
+static uint16_t _log_count{0};
+static uint32_t _log_overwritten{0};
+
+static void putUint32(uint8_t *buffer, uint32_t value)
+{
+    buffer[0] = value;
+    buffer[1] = value >> 8;
+    buffer[2] = value >> 16;
+    buffer[3] = value >> 24;
+}
+
+void NexLog::write(NexLogEvent event, int32_t arg)
+{
+    uint8_t *record = _log_buffer[(_log_head + _log_count) % NEX_LOG_BUFFER_RECORDS];
+    if(_log_count < NEX_LOG_BUFFER_RECORDS)
+    {
+        ++_log_count;
+    }
+    else
+    {
+        // oldest record is overwritten
+        _log_head = (_log_head + 1) % NEX_LOG_BUFFER_RECORDS;
+        ++_log_overwritten;
+    }
+    record[0] = event;
+    putUint32(&record[1], micros());
+    putUint32(&record[5], (uint32_t)arg);
+}
+
+uint16_t NexLog::dump(Print &out)
+{
+    uint8_t header[10]{'N', 'X', 'L', NEX_LOG_FORMAT_VERSION};
+    header[4] = _log_count;
+    header[5] = _log_count >> 8;
+    putUint32(&header[6], _log_overwritten);
+    out.write(header, sizeof(header));
+    uint16_t count = _log_count;
+    for(uint16_t i{0}; i < count; ++i)
+    {
+        out.write(_log_buffer[(_log_head + i) % NEX_LOG_BUFFER_RECORDS], NEX_LOG_RECORD_SIZE);
+    }
+    _log_head = 0;
+    _log_count = 0;
+    _log_overwritten = 0;
+    return count;
+}
+
+uint32_t NexLog::GetOverwrittenCount()
+{
+    return _log_overwritten;
+}
+
+#endif
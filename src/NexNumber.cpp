@@ -30,7 +30,12 @@ bool NexNumber::getValue(uint32_t *number)
     getObjGlobalPageName(cmd);
     cmd += ".val";
     sendCommand(cmd.c_str());
-    return recvRetNumber(number);
+    bool ret = recvRetNumber(number);
+    if (ret)
+    {
+        setCachedValue(*number);
+    }
+    return ret;
 }
 
 bool NexNumber::setValue(uint32_t number)
@@ -44,7 +49,23 @@ bool NexNumber::setValue(uint32_t number)
     cmd += buf;
 
     sendCommand(cmd.c_str());
-    return recvRetCommandFinished();
+    bool ret = recvRetCommandFinished();
+    if (ret)
+    {
+        setCachedValue(number);
+    }
+    return ret;
+}
+
+bool NexNumber::postValue(uint32_t number, uint32_t deadline)
+{
+    char buf[12] = {0};
+    String cmd;
+    utoa(number, buf, 10);
+    getObjGlobalPageName(cmd);
+    cmd += ".val=";
+    cmd += buf;
+    return postCommand(cmd.c_str(), deadline);
 }
 
 bool NexNumber::Get_background_color_bco(uint32_t *number)
@@ -18,6 +18,7 @@
  **/
 #include "NexObject.h"
 #include "NexHardware.h"
+#include "NexProfiler.h"
 
 NexObject::NexObject(Nextion *nextion, uint8_t pid, uint8_t cid, const char *name, const NexObject* page):
 NextionIf(nextion),
@@ -49,8 +50,36 @@ const char* NexObject::getObjPageName(void)
     return nullptr;
 }
 
+#ifdef NEX_SHORTEST_ADDRESSING
+// number of decimal digits of id
+static uint8_t idLength(uint8_t id)
+{
+    return id < 10 ? 1 : (id < 100 ? 2 : 3);
+}
+#endif
+
 void NexObject::getObjGlobalPageName(String &gName)
 {
+#ifdef NEX_SHORTEST_ADDRESSING
+    // id form b[cid] or p[pid].b[cid] when it is shorter than name form
+    size_t nameLen = strlen(_name) + (_page ? strlen(_page->getObjName()) + 1 : 0);
+    size_t idLen = 3 + idLength(_cid) + (_page ? 4 + idLength(_pid) : 0);
+    if(idLen < nameLen)
+    {
+        char id[16];
+        if(_page)
+        {
+            sprintf(id,"p[%u].b[%u]",_pid,_cid);
+        }
+        else
+        {
+            sprintf(id,"b[%u]",_cid);
+        }
+        gName += id;
+        NEX_PROFILE_ALIAS(id, getObjPageName(), _name);
+        return;
+    }
+#endif
     if(_page)
     {
         gName += _page->getObjName();
@@ -59,6 +88,22 @@ void NexObject::getObjGlobalPageName(String &gName)
     gName +=_name;
 }
 
+void NexObject::getObjLocalName(String &lName)
+{
+#ifdef NEX_SHORTEST_ADDRESSING
+    // vis and ref accept component id on current page
+    if(idLength(_cid) < strlen(_name))
+    {
+        char id[4];
+        sprintf(id,"%u",_cid);
+        lName += id;
+        NEX_PROFILE_ALIAS(id, nullptr, _name);
+        return;
+    }
+#endif
+    lName += _name;
+}
+
 bool NexObject::GetObjectWidth( uint32_t &width)
 {
     String cmd;
@@ -111,7 +156,7 @@ void NexObject::printObjInfo(void)
 bool NexObject::setVisible(bool visible)
 {
     String cmd = String("vis ");
-    cmd += _name;
+    getObjLocalName(cmd);
     cmd += ",";
     if(visible)
     {
@@ -128,7 +173,7 @@ bool NexObject::setVisible(bool visible)
 bool NexObject::refresh()
 {
     String cmd = String("ref ");
-    cmd += _name;
+    getObjLocalName(cmd);
     sendCommand(cmd.c_str());
     return recvRetCommandFinished();
 }
\ No newline at end of file
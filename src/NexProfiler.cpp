@@ -0,0 +1,156 @@
+/**
+ * @file NexProfiler.cpp
+ *
+ * The implementation of call site profiler. 
+ *
+ * @author Enhanced-Nextion-Library contributors 10/18/2026
+ * 
+ * @copyright 2026 Enhanced-Nextion-Library contributors
+ */
+#include "NexProfiler.h"
+
+#ifdef NEX_ENABLE_PROFILER
+
+static NexProfileEntry _profile_entries[NEX_PROFILER_SITES];
+static uint8_t _profile_count{0};
+static int16_t _profile_current{-1};
+static uint32_t _profile_dropped{0};
+static char _profile_alias_id[16];
+static const char *_profile_alias_page;
+static const char *_profile_alias_name;
+
+// append text to site, truncated to site size
+static uint8_t siteAppend(char *site, uint8_t len, const char *text)
+{
+    while(*text && len < NEX_PROFILER_SITE_SIZE - 1)
+    {
+        site[len++] = *text++;
+    }
+    return len;
+}
+
+void NexProfiler::setAlias(const char *id, const char *page, const char *name)
+{
+    strncpy(_profile_alias_id, id, sizeof(_profile_alias_id) - 1);
+    _profile_alias_id[sizeof(_profile_alias_id) - 1] = 0;
+    _profile_alias_page = page;
+    _profile_alias_name = name;
+}
+
+void NexProfiler::setSite(const char *cmd)
+{
+    char site[NEX_PROFILER_SITE_SIZE];
+    uint8_t len{0};
+    // alias applies to the command sent right after it was set
+    const char *alias{_profile_alias_id[0] ? strstr(cmd, _profile_alias_id) : nullptr};
+    size_t aliasLen{strlen(_profile_alias_id)};
+    _profile_alias_id[0] = 0;
+    while(*cmd && len < sizeof(site) - 1)
+    {
+        if(cmd == alias)
+        {
+            // symbolic name of id addressed component
+            if(_profile_alias_page)
+            {
+                len = siteAppend(site, len, _profile_alias_page);
+                len = siteAppend(site, len, ".");
+            }
+            len = siteAppend(site, len, _profile_alias_name);
+            cmd += aliasLen;
+        }
+        else
+        {
+            site[len++] = *cmd++;
+            if(site[len - 1] == '=')
+            {
+                break;
+            }
+        }
+        if(*cmd == ',' || *cmd == '"')
+        {
+            break;
+        }
+    }
+    site[len] = 0;
+
+    for(uint8_t i{0}; i < _profile_count; ++i)
+    {
+        if(strcmp(_profile_entries[i].site, site) == 0)
+        {
+            _profile_current = i;
+            return;
+        }
+    }
+    if(_profile_count >= NEX_PROFILER_SITES)
+    {
+        _profile_current = -1;
+        return;
+    }
+    NexProfileEntry &entry = _profile_entries[_profile_count];
+    strcpy(entry.site, site);
+    entry.count = 0;
+    entry.total = 0;
+    entry.max = 0;
+    _profile_current = _profile_count++;
+}
+
+void NexProfiler::record(uint32_t us)
+{
+    if(_profile_current < 0)
+    {
+        ++_profile_dropped;
+        return;
+    }
+    NexProfileEntry &entry = _profile_entries[_profile_current];
+    ++entry.count;
+    entry.total += us;
+    if(us > entry.max)
+    {
+        entry.max = us;
+    }
+}
+
+uint8_t NexProfiler::GetEntryCount()
+{
+    return _profile_count;
+}
+
+const NexProfileEntry& NexProfiler::GetEntry(uint8_t index)
+{
+    return _profile_entries[index];
+}
+
+uint32_t NexProfiler::GetDroppedCount()
+{
+    return _profile_dropped;
+}
+
+void NexProfiler::report(Print &out)
+{
+    out.println("site, count, total us, max us");
+    for(uint8_t i{0}; i < _profile_count; ++i)
+    {
+        const NexProfileEntry &entry = _profile_entries[i];
+        out.print(entry.site);
+        out.print(", ");
+        out.print(entry.count);
+        out.print(", ");
+        out.print(entry.total);
+        out.print(", ");
+        out.println(entry.max);
+    }
+    if(_profile_dropped)
+    {
+        out.print("not recorded: ");
+        out.println(_profile_dropped);
+    }
+}
+
+void NexProfiler::reset()
+{
+    _profile_count = 0;
+    _profile_current = -1;
+    _profile_dropped = 0;
+}
+
+#endif
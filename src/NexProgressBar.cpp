@@ -47,6 +47,17 @@ bool NexProgressBar::setValue(uint32_t number)
     return recvRetCommandFinished();
 }
 
+bool NexProgressBar::postValue(uint32_t number, uint32_t deadline)
+{
+    char buf[12] = {0};
+    String cmd;
+    utoa(number, buf, 10);
+    getObjGlobalPageName(cmd);
+    cmd += ".val=";
+    cmd += buf;
+    return postCommand(cmd.c_str(), deadline);
+}
+
 bool NexProgressBar::set_background_picture(uint32_t number)
 {
     char buf[10] = {0};
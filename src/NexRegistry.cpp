@@ -0,0 +1,198 @@
+/**
+ * @file NexRegistry.cpp
+ *
+ * The implementation of class NexRegistry. 
+ *
+ * @author Enhanced-Nextion-Library contributors 10/18/2026
+ * 
+ * @copyright 2026 Enhanced-Nextion-Library contributors
+ */
+
+#include "NexConfig.h"
+#ifdef NEX_ENABLE_DISCOVERY
+
+#include <EEPROM.h>
+#include "NexRegistry.h"
+
+#define NEX_REGISTRY_CACHE_VERSION 1
+
+// cache layout: 'N' 'R' version, fingerprint, count, components
+#define NEX_REGISTRY_CACHE_HEADER 8
+
+// FNV-1a hash step
+static uint32_t fingerprintAdd(uint32_t hash, uint32_t value)
+{
+    for(uint8_t i{0}; i < 4; ++i)
+    {
+        hash ^= (uint8_t)(value >> (8 * i));
+        hash *= 16777619UL;
+    }
+    return hash;
+}
+
+static void cacheWrite(int address, const uint8_t *data, size_t len)
+{
+    for(size_t i{0}; i < len; ++i)
+    {
+#ifdef ESP8266
+        EEPROM.write(address + i, data[i]);
+#else
+        EEPROM.update(address + i, data[i]);
+#endif
+    }
+}
+
+static void cacheRead(int address, uint8_t *data, size_t len)
+{
+    for(size_t i{0}; i < len; ++i)
+    {
+        data[i] = EEPROM.read(address + i);
+    }
+}
+
+NexRegistry::NexRegistry(Nextion *nextion)
+    :NextionIf(nextion)
+{
+}
+
+bool NexRegistry::queryFingerprint(const char *query, uint32_t &fingerprint)
+{
+    int32_t value;
+    sendCommand(query);
+    if(!recvRetNumber(&value))
+    {
+        return false;
+    }
+    fingerprint = fingerprintAdd(2166136261UL, value);
+    return true;
+}
+
+bool NexRegistry::typeFingerprint(uint8_t pid, uint32_t &fingerprint)
+{
+    uint32_t hash{2166136261UL};
+    int32_t type;
+    uint8_t cid{0};
+    for(; cid < NEX_REGISTRY_SIZE && QueryAttribute(pid, cid, "type", type); ++cid)
+    {
+        hash = fingerprintAdd(hash, type);
+    }
+    fingerprint = fingerprintAdd(hash, cid);
+    return cid > 0;
+}
+
+bool NexRegistry::QueryAttribute(uint8_t pid, uint8_t cid, const char *attribute, int32_t &value)
+{
+    char cmd[32];
+    sprintf(cmd, "get p[%u].b[%u].%s", pid, cid, attribute);
+    sendCommand(cmd);
+    return recvRetNumber(&value);
+}
+
+uint8_t NexRegistry::discoverPage(uint8_t pid)
+{
+    // replace previous entries of the page
+    uint8_t out{0};
+    for(uint8_t i{0}; i < m_count; ++i)
+    {
+        if(m_components[i].pid != pid)
+        {
+            m_components[out++] = m_components[i];
+        }
+    }
+    m_count = out;
+
+    uint8_t found{0};
+    int32_t value;
+    // component ids are consecutive, first failing id ends the page
+    for(uint8_t cid{0}; m_count < NEX_REGISTRY_SIZE && QueryAttribute(pid, cid, "type", value); ++cid)
+    {
+        NexComponentInfo &info = m_components[m_count++];
+        info.pid = pid;
+        info.cid = cid;
+        info.type = value;
+        info.x = QueryAttribute(pid, cid, "x", value) ? value : 0;
+        info.y = QueryAttribute(pid, cid, "y", value) ? value : 0;
+        info.w = QueryAttribute(pid, cid, "w", value) ? value : 0;
+        info.h = QueryAttribute(pid, cid, "h", value) ? value : 0;
+        ++found;
+    }
+    dbSerialPrint("Nextion page components discovered: ");
+    dbSerialPrintln(found);
+    return found;
+}
+
+bool NexRegistry::load(uint32_t fingerprint)
+{
+    uint8_t header[NEX_REGISTRY_CACHE_HEADER];
+    m_count = 0;
+    m_fingerprint = fingerprint;
+#ifdef ESP8266
+    EEPROM.begin(NEX_DISCOVERY_EEPROM_ADDRESS + NEX_REGISTRY_CACHE_HEADER + sizeof(m_components));
+#endif
+    cacheRead(NEX_DISCOVERY_EEPROM_ADDRESS, header, sizeof(header));
+    uint32_t cached;
+    memcpy(&cached, &header[3], sizeof(cached));
+    if(header[0] != 'N' || header[1] != 'R' || header[2] != NEX_REGISTRY_CACHE_VERSION ||
+        cached != fingerprint || header[7] > NEX_REGISTRY_SIZE)
+    {
+        return false;
+    }
+    m_count = header[7];
+    cacheRead(NEX_DISCOVERY_EEPROM_ADDRESS + NEX_REGISTRY_CACHE_HEADER, (uint8_t*)m_components, m_count * sizeof(m_components[0]));
+    return true;
+}
+
+void NexRegistry::save()
+{
+    uint8_t header[NEX_REGISTRY_CACHE_HEADER]{'N', 'R', NEX_REGISTRY_CACHE_VERSION};
+    memcpy(&header[3], &m_fingerprint, sizeof(m_fingerprint));
+    header[7] = m_count;
+#ifdef ESP8266
+    EEPROM.begin(NEX_DISCOVERY_EEPROM_ADDRESS + NEX_REGISTRY_CACHE_HEADER + sizeof(m_components));
+#endif
+    // invalidate old header first, interrupted write must not pass as cache of old fingerprint
+    const uint8_t invalid{0};
+    cacheWrite(NEX_DISCOVERY_EEPROM_ADDRESS, &invalid, sizeof(invalid));
+    cacheWrite(NEX_DISCOVERY_EEPROM_ADDRESS + NEX_REGISTRY_CACHE_HEADER, (const uint8_t*)m_components, m_count * sizeof(m_components[0]));
+    // header last, cache is valid only when completely written
+    cacheWrite(NEX_DISCOVERY_EEPROM_ADDRESS, header, sizeof(header));
+#ifdef ESP8266
+    EEPROM.commit();
+#endif
+}
+
+const NexComponentInfo* NexRegistry::find(uint8_t pid, uint8_t cid) const
+{
+    for(uint8_t i{0}; i < m_count; ++i)
+    {
+        if(m_components[i].pid == pid && m_components[i].cid == cid)
+        {
+            return &m_components[i];
+        }
+    }
+    return nullptr;
+}
+
+const NexComponentInfo* NexRegistry::findByType(uint8_t pid, uint8_t type, uint8_t index) const
+{
+    for(uint8_t i{0}; i < m_count; ++i)
+    {
+        if(m_components[i].pid == pid && m_components[i].type == type && index-- == 0)
+        {
+            return &m_components[i];
+        }
+    }
+    return nullptr;
+}
+
+uint8_t NexRegistry::GetCount() const
+{
+    return m_count;
+}
+
+const NexComponentInfo& NexRegistry::GetInfo(uint8_t index) const
+{
+    return m_components[index];
+}
+
+#endif
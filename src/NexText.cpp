@@ -45,6 +45,26 @@ bool NexText::getText(char *buffer, uint16_t &len)
     return recvRetString(buffer,len);
 }
 
+bool NexText::getText(char *buffer, uint16_t &len, bool &truncated)
+{
+    String cmd;
+    cmd += "get ";
+    getObjGlobalPageName(cmd);
+    cmd += ".txt";
+    sendCommand(cmd.c_str());
+    return recvRetString(buffer, len, truncated);
+}
+
+bool NexText::getText(NexStringSinkCb sink, void *ptr)
+{
+    String cmd;
+    cmd += "get ";
+    getObjGlobalPageName(cmd);
+    cmd += ".txt";
+    sendCommand(cmd.c_str());
+    return recvRetString(sink, ptr);
+}
+
 bool NexText::setText(const char *buffer)
 {
     String cmd;
@@ -56,6 +76,16 @@ bool NexText::setText(const char *buffer)
     return recvRetCommandFinished();    
 }
 
+bool NexText::postText(const char *buffer, uint32_t deadline)
+{
+    String cmd;
+    getObjGlobalPageName(cmd);
+    cmd += ".txt=\"";
+    cmd += buffer;
+    cmd += "\"";
+    return postCommand(cmd.c_str(), deadline);
+}
+
 bool NexText::appendText(const char *buffer)
 {
     String cmd;
@@ -0,0 +1,259 @@
+/**
+ * @file NexTimerWheel.cpp
+ *
+ * The implementation of class NexTimerWheel and NexWheelTimer.
+ *
+ * @author Enhanced-Nextion-Library contributors 10/18/2026
+ *
+ * @copyright 2026 Enhanced-Nextion-Library contributors
+ */
+
+#include "NexTimerWheel.h"
+
+#define NEX_TIMER_WHEEL_MASK (NEX_TIMER_WHEEL_SLOTS - 1)
+
+NexWheelTimer::NexWheelTimer(NexWheelTimerCb callback, void *ptr)
+    :m_cb{callback}, m_ptr{ptr}
+{
+}
+
+bool NexWheelTimer::isActive() const
+{
+    return m_pprev != nullptr;
+}
+
+NexTimerWheel::NexTimerWheel(uint16_t tick)
+    :m_readyTail{&m_ready}, m_tick{tick ? tick : (uint16_t)1}, m_lastTime{millis()}
+{
+    for(uint8_t level{0}; level < NEX_TIMER_WHEEL_LEVELS; ++level)
+    {
+        for(uint16_t slot{0}; slot < NEX_TIMER_WHEEL_SLOTS; ++slot)
+        {
+            m_slots[level][slot] = nullptr;
+        }
+    }
+}
+
+void NexTimerWheel::Link(NexWheelTimer **head, NexWheelTimer &timer)
+{
+    timer.m_next = *head;
+    if(timer.m_next)
+    {
+        timer.m_next->m_pprev = &timer.m_next;
+    }
+    *head = &timer;
+    timer.m_pprev = head;
+}
+
+void NexTimerWheel::Unlink(NexWheelTimer &timer)
+{
+    if(m_readyTail == &timer.m_next)
+    {
+        m_readyTail = timer.m_pprev;
+    }
+    *timer.m_pprev = timer.m_next;
+    if(timer.m_next)
+    {
+        timer.m_next->m_pprev = timer.m_pprev;
+    }
+    timer.m_next = nullptr;
+    timer.m_pprev = nullptr;
+}
+
+void NexTimerWheel::Insert(NexWheelTimer &timer)
+{
+    int32_t delta = (int32_t)(timer.m_expires - m_current);
+    if(delta <= 0)
+    {
+        Link(m_readyTail, timer);
+        m_readyTail = &timer.m_next;
+        return;
+    }
+    uint8_t level;
+    uint32_t slotTick{timer.m_expires};
+    if((uint32_t)delta < NEX_TIMER_WHEEL_SLOTS)
+    {
+        level = 0;
+    }
+    else if((uint32_t)delta < ((uint32_t)1 << (2 * NEX_TIMER_WHEEL_SLOT_BITS)))
+    {
+        level = 1;
+    }
+    else
+    {
+        level = 2;
+        if((uint32_t)delta >= ((uint32_t)1 << (3 * NEX_TIMER_WHEEL_SLOT_BITS)))
+        {
+            // beyond wheel range, last slot of the rotation, rescheduled when cascaded
+            slotTick = m_current - ((uint32_t)1 << (2 * NEX_TIMER_WHEEL_SLOT_BITS));
+        }
+    }
+    uint16_t slot = (slotTick >> (level * NEX_TIMER_WHEEL_SLOT_BITS)) & NEX_TIMER_WHEEL_MASK;
+    Link(&m_slots[level][slot], timer);
+}
+
+void NexTimerWheel::Cascade(uint8_t level)
+{
+    uint16_t slot = (m_current >> (level * NEX_TIMER_WHEEL_SLOT_BITS)) & NEX_TIMER_WHEEL_MASK;
+    NexWheelTimer *timer = m_slots[level][slot];
+    m_slots[level][slot] = nullptr;
+    while(timer)
+    {
+        NexWheelTimer *next = timer->m_next;
+        timer->m_next = nullptr;
+        Insert(*timer);
+        timer = next;
+    }
+}
+
+void NexTimerWheel::Advance(uint32_t ticks)
+{
+    while((int32_t)(ticks - m_current) > 0)
+    {
+        if(!m_count)
+        {
+            // nothing to expire
+            m_current = ticks;
+            return;
+        }
+        ++m_current;
+        if((m_current & NEX_TIMER_WHEEL_MASK) == 0)
+        {
+            Cascade(1);
+            if(((m_current >> NEX_TIMER_WHEEL_SLOT_BITS) & NEX_TIMER_WHEEL_MASK) == 0)
+            {
+                Cascade(2);
+            }
+        }
+        // all timers of current level 0 slot expire now
+        NexWheelTimer *&slot = m_slots[0][m_current & NEX_TIMER_WHEEL_MASK];
+        while(slot)
+        {
+            NexWheelTimer &timer = *slot;
+            Unlink(timer);
+            Link(m_readyTail, timer);
+            m_readyTail = &timer.m_next;
+        }
+    }
+}
+
+void NexTimerWheel::Update()
+{
+    // time since last update, whole ticks advance the wheel and the rest is carried,
+    // so millis() wrap around does not disturb tick count
+    uint32_t now{millis()};
+    uint32_t elapsed{now - m_lastTime + m_remainder};
+    m_lastTime = now;
+    m_remainder = elapsed % m_tick;
+    Advance(m_current + elapsed / m_tick);
+}
+
+void NexTimerWheel::start(NexWheelTimer &timer, uint32_t delay, uint32_t period)
+{
+    stop(timer);
+    Update();
+    // expiry is not before delay from now, now may be within current tick
+    timer.m_expires = m_current + (delay + m_remainder + m_tick - 1) / m_tick;
+    timer.m_period = period ? (period + m_tick / 2) / m_tick : 0;
+    if(period && !timer.m_period)
+    {
+        timer.m_period = 1;
+    }
+    ++m_count;
+    Insert(timer);
+}
+
+void NexTimerWheel::stop(NexWheelTimer &timer)
+{
+    if(timer.isActive())
+    {
+        Unlink(timer);
+        --m_count;
+    }
+}
+
+void NexTimerWheel::setBudget(uint32_t budget)
+{
+    m_budget = budget;
+}
+
+void NexTimerWheel::poll()
+{
+    Update();
+    uint32_t start{micros()};
+    while(m_ready)
+    {
+        NexWheelTimer &timer = *m_ready;
+        Unlink(timer);
+        // expiry time back from start of current tick, callbacks may have updated the wheel
+        uint32_t expiryTime{m_lastTime - m_remainder - (m_current - timer.m_expires) * m_tick};
+        uint32_t jitter{millis() - expiryTime};
+        if((int32_t)jitter < 0)
+        {
+            jitter = 0;
+        }
+        if(jitter > m_jitterMax)
+        {
+            m_jitterMax = jitter;
+        }
+        if(m_jitterSum + jitter < m_jitterSum)
+        {
+            // keep average, halve history
+            m_jitterSum /= 2;
+            m_jitterSumCount /= 2;
+        }
+        m_jitterSum += jitter;
+        ++m_jitterSumCount;
+        ++m_expired;
+        if(timer.m_period)
+        {
+            // next expiry keeps phase, missed periods are skipped
+            timer.m_expires += timer.m_period;
+            if((int32_t)(timer.m_expires - m_current) <= 0)
+            {
+                timer.m_expires += ((m_current - timer.m_expires) / timer.m_period + 1) * timer.m_period;
+            }
+            Insert(timer);
+        }
+        else
+        {
+            --m_count;
+        }
+        // timer may be stopped or restarted in callback
+        timer.m_cb(timer.m_ptr);
+        if(m_budget && m_ready && micros() - start >= m_budget)
+        {
+            ++m_deferred;
+            break;
+        }
+    }
+}
+
+uint32_t NexTimerWheel::GetExpiredCount() const
+{
+    return m_expired;
+}
+
+uint32_t NexTimerWheel::GetMaxJitter() const
+{
+    return m_jitterMax;
+}
+
+uint32_t NexTimerWheel::GetAverageJitter() const
+{
+    return m_jitterSumCount ? m_jitterSum / m_jitterSumCount : 0;
+}
+
+uint32_t NexTimerWheel::GetDeferredCount() const
+{
+    return m_deferred;
+}
+
+void NexTimerWheel::resetStatistics()
+{
+    m_expired = 0;
+    m_jitterMax = 0;
+    m_jitterSum = 0;
+    m_jitterSumCount = 0;
+    m_deferred = 0;
+}
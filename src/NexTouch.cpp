@@ -20,6 +20,14 @@
 #include "NexTouch.h"
 #include "NexHardware.h"
 
+// listener event of value change
+#define NEX_EVENT_VALUE_CHANGE  (0x02)
+#define NEX_NO_LISTENER         (0xFF)
+// listener removed during dispatch, unlinked when dispatch ends
+#define NEX_EVENT_REMOVED       (0xFF)
+
+static nexListener _nex_listeners[NEX_MAX_LISTENERS];
+
 NexTouch::NexTouch(Nextion *nextion, uint8_t pid, uint8_t cid, const char *name, const NexObject* page)
     :NexObject(nextion, pid, cid, name, page)
 {
@@ -27,6 +35,20 @@ NexTouch::NexTouch(Nextion *nextion, uint8_t pid, uint8_t cid, const char *name,
     this->__cb_pop = nullptr;
     this->__cbpop_ptr = nullptr;
     this->__cbpush_ptr = nullptr;
+    this->__cb_value = nullptr;
+    this->__cbvalue_ptr = nullptr;
+    this->__cached_value = 0;
+    this->__cached_value_valid = false;
+    this->__listeners = NEX_NO_LISTENER;
+    this->__dispatching = 0;
+}
+
+NexTouch::~NexTouch()
+{
+    for(uint8_t i = __listeners; i != NEX_NO_LISTENER; i = _nex_listeners[i].next)
+    {
+        _nex_listeners[i].used = false;
+    }
 }
 
 void NexTouch::attachPush(NexTouchEventCb push, void *ptr)
@@ -53,12 +75,213 @@ void NexTouch::detachPop(void)
     this->__cbpop_ptr = nullptr;
 }
 
+void NexTouch::attachValueChange(NexValueChangeCb change, void *ptr)
+{
+    this->__cb_value = change;
+    this->__cbvalue_ptr = ptr;
+}
+
+void NexTouch::detachValueChange(void)
+{
+    this->__cb_value = nullptr;
+    this->__cbvalue_ptr = nullptr;
+}
+
+bool NexTouch::addListener(uint8_t event, nexListener &listener)
+{
+    for(uint8_t i = 0; i < NEX_MAX_LISTENERS; i++)
+    {
+        if (!_nex_listeners[i].used)
+        {
+            listener.event = event;
+            listener.next = NEX_NO_LISTENER;
+            listener.used = true;
+            _nex_listeners[i] = listener;
+            // append to keep call order
+            uint8_t *link = &__listeners;
+            while (*link != NEX_NO_LISTENER)
+            {
+                link = &_nex_listeners[*link].next;
+            }
+            *link = i;
+            return true;
+        }
+    }
+    dbSerialPrintln("Nex listener pool full");
+    return false;
+}
+
+bool NexTouch::addPushListener(NexTouchEventCb push, void *ptr)
+{
+    nexListener listener;
+    listener.callback.touch = push;
+    listener.ptr = ptr;
+    return addListener(NEX_EVENT_PUSH, listener);
+}
+
+bool NexTouch::addPopListener(NexTouchEventCb pop, void *ptr)
+{
+    nexListener listener;
+    listener.callback.touch = pop;
+    listener.ptr = ptr;
+    return addListener(NEX_EVENT_POP, listener);
+}
+
+bool NexTouch::addValueChangeListener(NexValueChangeCb change, void *ptr)
+{
+    nexListener listener;
+    listener.callback.value = change;
+    listener.ptr = ptr;
+    return addListener(NEX_EVENT_VALUE_CHANGE, listener);
+}
+
+void NexTouch::unlinkListener(uint8_t *link)
+{
+    nexListener &listener = _nex_listeners[*link];
+    if (__dispatching)
+    {
+        // keep slot linked, callListeners may be iterating it
+        listener.event = NEX_EVENT_REMOVED;
+        return;
+    }
+    listener.used = false;
+    *link = listener.next;
+}
+
+void NexTouch::sweepListeners(void)
+{
+    for(uint8_t *link = &__listeners; *link != NEX_NO_LISTENER;)
+    {
+        if (_nex_listeners[*link].event == NEX_EVENT_REMOVED)
+        {
+            unlinkListener(link);
+        }
+        else
+        {
+            link = &_nex_listeners[*link].next;
+        }
+    }
+}
+
+bool NexTouch::removeListener(NexTouchEventCb callback, void *ptr)
+{
+    for(uint8_t *link = &__listeners; *link != NEX_NO_LISTENER; link = &_nex_listeners[*link].next)
+    {
+        const nexListener &listener = _nex_listeners[*link];
+        if ((listener.event == NEX_EVENT_PUSH || listener.event == NEX_EVENT_POP) &&
+            listener.callback.touch == callback && listener.ptr == ptr)
+        {
+            unlinkListener(link);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool NexTouch::removeListener(NexValueChangeCb callback, void *ptr)
+{
+    for(uint8_t *link = &__listeners; *link != NEX_NO_LISTENER; link = &_nex_listeners[*link].next)
+    {
+        const nexListener &listener = _nex_listeners[*link];
+        if (listener.event == NEX_EVENT_VALUE_CHANGE && listener.callback.value == callback && listener.ptr == ptr)
+        {
+            unlinkListener(link);
+            return true;
+        }
+    }
+    return false;
+}
+
+void NexTouch::callListeners(uint8_t event, int32_t value)
+{
+    // listeners removed by a callback stay linked until the outermost dispatch ends,
+    // listeners added by a callback are appended and called for the current event too
+    ++__dispatching;
+    for(uint8_t i = __listeners; i != NEX_NO_LISTENER; i = _nex_listeners[i].next)
+    {
+        const nexListener &listener = _nex_listeners[i];
+        if (listener.event != event)
+        {
+            continue;
+        }
+        if (event == NEX_EVENT_VALUE_CHANGE)
+        {
+            listener.callback.value(value, listener.ptr);
+        }
+        else
+        {
+            listener.callback.touch(listener.ptr);
+        }
+    }
+    if (--__dispatching == 0)
+    {
+        sweepListeners();
+    }
+}
+
+bool NexTouch::getCachedValue(int32_t &value) const
+{
+    if (__cached_value_valid)
+    {
+        value = __cached_value;
+    }
+    return __cached_value_valid;
+}
+
+bool NexTouch::getCachedValue(uint32_t *number) const
+{
+    int32_t value;
+    if (!getCachedValue(value))
+    {
+        return false;
+    }
+    *number = value;
+    return true;
+}
+
+void NexTouch::setCachedValue(int32_t value)
+{
+    __cached_value = value;
+    __cached_value_valid = true;
+}
+
+void NexTouch::getValueChangeSnippet(String &snippet, const char *attribute)
+{
+    char buf[4] = {0};
+    utoa(NEX_RET_VALUE_CHANGE_HEAD, buf, 16);
+    snippet += "printh ";
+    snippet += buf;
+    snippet += "\r\nprints dp,1\r\nprints ";
+    snippet += getObjName();
+    snippet += ".id,1\r\nprints ";
+    snippet += getObjName();
+    snippet += ".";
+    snippet += attribute;
+    snippet += ",4\r\nprinth FF FF FF\r\n";
+}
+
+void NexTouch::valueChanged(int32_t value)
+{
+    bool changed{!__cached_value_valid || __cached_value != value};
+    setCachedValue(value);
+    if (!changed)
+    {
+        return;
+    }
+    if (__cb_value)
+    {
+        __cb_value(value, __cbvalue_ptr);
+    }
+    callListeners(NEX_EVENT_VALUE_CHANGE, value);
+}
+
 void NexTouch::push(void)
 {
     if (__cb_push)
     {
         __cb_push(__cbpush_ptr);
     }
+    callListeners(NEX_EVENT_PUSH);
 }
 
 void NexTouch::pop(void)
@@ -67,6 +290,7 @@ void NexTouch::pop(void)
     {
         __cb_pop(__cbpop_ptr);
     }
+    callListeners(NEX_EVENT_POP);
 }
 
 void NexTouch::iterate(NexTouch **list, uint8_t pid, uint8_t cid, uint8_t event)
@@ -107,3 +331,25 @@ void NexTouch::iterate(NexTouch **list, uint8_t pid, uint8_t cid, uint8_t event)
     }
 }
 
+void NexTouch::iterateValueChange(NexTouch **list, uint8_t pid, uint8_t cid, int32_t value)
+{
+    NexTouch *e = nullptr;
+
+    if (nullptr == list)
+    {
+        dbSerialPrintln("Nex Touch events not registered/listed");
+        return;
+    }
+    for(uint16_t i = 0; (e = list[i]) != nullptr; i++)
+    {
+        if (e->getObjPid() == pid && e->getObjCid() == cid)
+        {
+            e->valueChanged(value);
+            return;
+        }
+    }
+    dbSerialPrint("Nex value change not registered Pid: ");
+    dbSerialPrint(pid);
+    dbSerialPrint(" Cid: ");
+    dbSerialPrintln(cid);
+}
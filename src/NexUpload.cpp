@@ -22,6 +22,12 @@
 #include "NexConfig.h"
 #include "NexUpload.h"
 #include "NextionIf.h"
+#include "NexHardware.h"
+
+// display busy time of writing 4096 byte block to flash and of preparing upload,
+// link delay of instance configuration is added
+#define NEX_UPLOAD_BLOCK_TIME   (400)
+#define NEX_UPLOAD_INIT_TIME    (450)
 
 NexUpload::NexUpload(Nextion *nextion)
     :NextionIf(nextion)
@@ -35,7 +41,7 @@ bool NexUpload::upload(File  &tftFile)
 {
     Reconnect();
     
-    if(!InitUpload(tftFile))
+    if(!InitUpload(tftFile.size()))
     {
         dbSerialPrintln("Initialize upload error");
         return false;
@@ -49,29 +55,48 @@ bool NexUpload::upload(File  &tftFile)
     return true;
 }
 
+bool NexUpload::upload(NexSpan<const uint8_t> tft)
+{
+    Reconnect();
+    
+    if(!InitUpload(tft.size()))
+    {
+        dbSerialPrintln("Initialize upload error");
+        return false;
+    }
+    if(!_downloadTftData(tft))
+    {
+        dbSerialPrintln("download data error");
+        return false;
+    }
+    dbSerialPrintln("download ok\r\n");
+    return true;
+}
+
 void NexUpload::Reconnect()
 {
+    String resp;
+    // invalid command, wait until display replies the error
     sendCommand("DRAKJHSUYDGBNCJHGJKSHBDN");
-    delay(500);
+    recvRetString(resp, NEX_UPLOAD_BLOCK_TIME + GetConfig().returnTimeout, false);
     sendCommand("connect");
-    delay(50);
+    RecvConnect(50);
     sendCommand("ÿÿconnect");
-    delay(200);
+    RecvConnect(200);
 }
 
 
-bool NexUpload::InitUpload(File  &tftFile)
+bool NexUpload::InitUpload(uint32_t size)
 {
     String string = String(""); 
     String cmd = String("");
     
-    String filesize_str = String(tftFile.size(),10);
+    String filesize_str = String(size,10);
     String baudrate_str = String(GetCurrentBaud(),10);
     cmd = "whmi-wri " + filesize_str + "," + baudrate_str + ",0";
     
     sendCommand(cmd.c_str());
-    delay(50);
-    if(!recvCommand(0x05, 500))
+    if(!recvCommand(0x05, NEX_UPLOAD_INIT_TIME + GetConfig().returnTimeout))
     { 
         return false;
     } 
@@ -114,7 +139,7 @@ bool NexUpload::_downloadTftFile(File  &tftFile)
                 sendRawByte(c);
             }
         }
-        if(!recvCommand(0x05, 500))
+        if(!recvCommand(0x05, NEX_UPLOAD_BLOCK_TIME + GetConfig().returnTimeout))
         {
             return false;
         }
@@ -122,4 +147,18 @@ bool NexUpload::_downloadTftFile(File  &tftFile)
     } 
     return true;
 }
+
+bool NexUpload::_downloadTftData(NexSpan<const uint8_t> tft)
+{
+    // display acknowledges each 4096 byte block
+    for(size_t offset{0}; offset < tft.size(); offset += 4096)
+    {
+        sendRawData(tft.subspan(offset, 4096));
+        if(!recvCommand(0x05, NEX_UPLOAD_BLOCK_TIME + GetConfig().returnTimeout))
+        {
+            return false;
+        }
+    }
+    return true;
+}
 #endif
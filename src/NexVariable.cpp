@@ -36,10 +36,10 @@ bool NexVariable::getValue(int32_t *number)
 
 bool NexVariable::setValue(int32_t number)
 {
-    char buf[10] = {0};
+    char buf[12] = {0};
     String cmd;
     
-    itoa(number, buf, 10);
+    ltoa(number, buf, 10);
     getObjGlobalPageName(cmd);
     cmd += ".val=";
     cmd += buf;
@@ -47,6 +47,17 @@ bool NexVariable::setValue(int32_t number)
     sendCommand(cmd.c_str());
     return recvRetCommandFinished();
 }
+
+bool NexVariable::postValue(int32_t number, uint32_t deadline)
+{
+    char buf[12] = {0};
+    String cmd;
+    ltoa(number, buf, 10);
+    getObjGlobalPageName(cmd);
+    cmd += ".val=";
+    cmd += buf;
+    return postCommand(cmd.c_str(), deadline);
+}
 bool NexVariable::getText(String &str)
 {
     String cmd;
@@ -76,4 +87,14 @@ bool NexVariable::setText(const char *buffer)
     cmd += "\"";
     sendCommand(cmd.c_str());
     return recvRetCommandFinished();    
+}
+
+bool NexVariable::postText(const char *buffer, uint32_t deadline)
+{
+    String cmd;
+    getObjGlobalPageName(cmd);
+    cmd += ".txt=\"";
+    cmd += buffer;
+    cmd += "\"";
+    return postCommand(cmd.c_str(), deadline);
 }
\ No newline at end of file
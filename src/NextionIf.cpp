@@ -11,6 +11,7 @@
 
 #include "NextionIf.h"
 #include "NexHardware.h"
+#include "NexProfiler.h"
 
 
 NextionIf::NextionIf(Nextion *nextion):m_nextion{nextion}
@@ -22,29 +23,51 @@ NextionIf::~NextionIf()
 
 bool NextionIf::recvRetNumber(uint32_t *number, size_t timeout)
 {
+    NEX_PROFILE_SCOPE();
     return m_nextion->recvRetNumber(number, timeout);
 }
 
 bool NextionIf::recvRetNumber(int32_t *number, size_t timeout)
 {
+    NEX_PROFILE_SCOPE();
     return m_nextion->recvRetNumber(number, timeout);
 }
 
 bool NextionIf::recvRetString(String &str, size_t timeout, bool start_flag)
 {
+    NEX_PROFILE_SCOPE();
     return m_nextion->recvRetString(str, timeout, start_flag);
 }
 
 bool NextionIf::recvRetString(char *buffer, uint16_t &len, size_t timeout, bool start_flag)
 {
+    NEX_PROFILE_SCOPE();
     return m_nextion->recvRetString(buffer, len, timeout, start_flag);
 }
 
+bool NextionIf::recvRetString(char *buffer, uint16_t &len, bool &truncated, size_t timeout, bool start_flag)
+{
+    NEX_PROFILE_SCOPE();
+    return m_nextion->recvRetString(buffer, len, truncated, timeout, start_flag);
+}
+
+bool NextionIf::recvRetString(NexStringSinkCb sink, void *ptr, size_t timeout, bool start_flag)
+{
+    NEX_PROFILE_SCOPE();
+    return m_nextion->recvRetString(sink, ptr, timeout, start_flag);
+}
+
 void NextionIf::sendCommand(const char* cmd)
 {
+    NEX_PROFILE_SITE(cmd);
     return m_nextion->sendCommand(cmd);
 }
 
+bool NextionIf::postCommand(const char* cmd, uint32_t deadline)
+{
+    return m_nextion->postCommand(cmd, deadline);
+}
+
 #ifdef ESP8266
 void NextionIf::sendRawData(const std::vector<uint8_t> &data)
 {
@@ -57,6 +80,11 @@ void NextionIf::sendRawData(const uint8_t *buf, uint16_t len)
     return m_nextion->sendRawData(buf, len);
 }
 
+void NextionIf::sendRawData(NexSpan<const uint8_t> data)
+{
+    return m_nextion->sendRawData(data);
+}
+
 void NextionIf::sendRawByte(const uint8_t byte)
 {
     return m_nextion->sendRawByte(byte);
@@ -64,17 +92,20 @@ void NextionIf::sendRawByte(const uint8_t byte)
 
 size_t NextionIf::readBytes(uint8_t* buffer, size_t size, size_t timeout)
 {
+    NEX_PROFILE_SCOPE();
     return m_nextion->readBytes(buffer, size, timeout);
 }
 
 
 bool NextionIf::recvCommand(const uint8_t command, size_t timeout)
 {
+    NEX_PROFILE_SCOPE();
     return m_nextion->recvCommand(command, timeout);
 }
 
 bool NextionIf::recvRetCommandFinished(size_t timeout)
 {
+    NEX_PROFILE_SCOPE();
     return m_nextion->recvRetCommandFinished(timeout);
 }
 
@@ -88,7 +119,17 @@ bool NextionIf::RecvTransparendDataModeFinished(size_t timeout)
     return m_nextion->RecvTransparendDataModeFinished(timeout);
 }
 
+bool NextionIf::RecvConnect(size_t timeout)
+{
+    return m_nextion->RecvConnect(timeout);
+}
+
 uint32_t NextionIf::GetCurrentBaud()
 {
     return m_nextion->GetCurrentBaud();
 }
+
+const NexInstanceConfig &NextionIf::GetConfig() const
+{
+    return m_nextion->GetConfig();
+}
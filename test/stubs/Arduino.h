@@ -0,0 +1,36 @@
+/**
+ * @file Arduino.h
+ *
+ * Minimal Arduino core for host side tests.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "WString.h"
+#include "HardwareSerial.h"
+
+uint32_t millis();
+uint32_t micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+
+template<typename A, typename B>
+auto min(A a, B b) -> decltype(a < b ? a : b)
+{
+    return a < b ? a : b;
+}
+
+template<typename A, typename B>
+auto max(A a, B b) -> decltype(a < b ? a : b)
+{
+    return a > b ? a : b;
+}
+
+#define F(x) x
+#define PROGMEM
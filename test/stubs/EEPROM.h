@@ -0,0 +1,24 @@
+/**
+ * @file EEPROM.h
+ *
+ * Arduino EEPROM for host side tests, byte array in memory.
+ */
+
+#pragma once
+
+#include "Arduino.h"
+
+class EEPROMClass
+{
+public:
+    uint8_t read(int address) {return data[address];}
+    void write(int address, uint8_t value) {data[address] = value; ++writes;}
+    void update(int address, uint8_t value) {if(data[address] != value) write(address, value);}
+    void begin(size_t) {}
+    bool commit() {return true;}
+
+    uint8_t data[1024]{};
+    uint32_t writes{0};
+};
+
+extern EEPROMClass EEPROM;
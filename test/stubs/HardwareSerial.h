@@ -0,0 +1,23 @@
+/**
+ * @file HardwareSerial.h
+ *
+ * Arduino HardwareSerial for host side tests, tests derive fake serial ports from it.
+ */
+
+#pragma once
+
+#include "Stream.h"
+
+class HardwareSerial: public Stream
+{
+public:
+    virtual void begin(unsigned long) {}
+    virtual void end() {}
+    int available() override {return 0;}
+    int read() override {return -1;}
+    int peek() override {return -1;}
+    size_t write(uint8_t) override {return 1;}
+    using Print::write;
+};
+
+extern HardwareSerial Serial;
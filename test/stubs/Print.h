@@ -0,0 +1,53 @@
+/**
+ * @file Print.h
+ *
+ * Arduino Print subset for host side tests.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+class String;
+
+class Print
+{
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t *buffer, size_t size)
+    {
+        for(size_t i{0}; i < size; ++i)
+        {
+            write(buffer[i]);
+        }
+        return size;
+    }
+    size_t write(const char *str)
+    {
+        size_t n{0};
+        while(str[n])
+        {
+            write((uint8_t)str[n++]);
+        }
+        return n;
+    }
+    size_t print(const char *str) {return write(str);}
+    size_t print(const String &) {return 0;}
+    size_t print(char) {return 0;}
+    size_t print(int, int = 10) {return 0;}
+    size_t print(unsigned, int = 10) {return 0;}
+    size_t print(long, int = 10) {return 0;}
+    size_t print(unsigned long, int = 10) {return 0;}
+    size_t print(double, int = 2) {return 0;}
+    size_t println() {return 0;}
+    size_t println(const char *) {return 0;}
+    size_t println(const String &) {return 0;}
+    size_t println(int, int = 10) {return 0;}
+    size_t println(unsigned, int = 10) {return 0;}
+    size_t println(long, int = 10) {return 0;}
+    size_t println(unsigned long, int = 10) {return 0;}
+    virtual int availableForWrite() {return 0;}
+    virtual void flush() {}
+};
@@ -0,0 +1,15 @@
+/**
+ * @file SoftwareSerial.h
+ *
+ * Arduino SoftwareSerial for host side tests.
+ */
+
+#pragma once
+
+#include "Arduino.h"
+
+class SoftwareSerial: public HardwareSerial
+{
+public:
+    SoftwareSerial(int, int) {}
+};
@@ -0,0 +1,28 @@
+/**
+ * @file Stream.h
+ *
+ * Arduino Stream subset for host side tests.
+ */
+
+#pragma once
+
+#include "Print.h"
+
+class Stream: public Print
+{
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+    virtual size_t readBytes(char *buffer, size_t size)
+    {
+        size_t n{0};
+        for(int c; n < size && (c = read()) >= 0; ++n)
+        {
+            buffer[n] = (char)c;
+        }
+        return n;
+    }
+    size_t readBytes(uint8_t *buffer, size_t size) {return readBytes((char*)buffer, size);}
+    void setTimeout(unsigned long) {}
+};
@@ -0,0 +1,52 @@
+/**
+ * @file WString.h
+ *
+ * Arduino String subset for host side tests.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string>
+
+char *utoa(unsigned value, char *buffer, int radix);
+char *itoa(int value, char *buffer, int radix);
+char *ltoa(long value, char *buffer, int radix);
+char *ultoa(unsigned long value, char *buffer, int radix);
+
+class String
+{
+public:
+    String(const char *str = ""):m_str{str} {}
+    String(int value):m_str{std::to_string(value)} {}
+    String(unsigned long value, int = 10):m_str{std::to_string(value)} {}
+
+    String &operator+=(const String &str) {m_str += str.m_str; return *this;}
+    String &operator+=(const char *str) {m_str += str; return *this;}
+    String &operator+=(char c) {m_str += c; return *this;}
+    String &operator+=(unsigned char value) {m_str += std::to_string(value); return *this;}
+    String &operator+=(int value) {m_str += std::to_string(value); return *this;}
+    String &operator+=(unsigned value) {m_str += std::to_string(value); return *this;}
+    String &operator+=(long value) {m_str += std::to_string(value); return *this;}
+    String &operator+=(unsigned long value) {m_str += std::to_string(value); return *this;}
+    friend String operator+(const String &a, const String &b) {String r{a}; r += b; return r;}
+    friend String operator+(const String &a, const char *b) {String r{a}; r += b; return r;}
+    friend String operator+(const char *a, const String &b) {String r{a}; r += b; return r;}
+    bool operator==(const char *str) const {return m_str == str;}
+
+    bool concat(const char *str, unsigned len) {m_str.append(str, len); return true;}
+    bool concat(char c) {m_str += c; return true;}
+    bool reserve(unsigned size) {m_str.reserve(size); return true;}
+    void remove(unsigned index) {m_str.erase(index);}
+    int indexOf(const char *str) const
+    {
+        size_t pos = m_str.find(str);
+        return pos == std::string::npos ? -1 : (int)pos;
+    }
+    char operator[](unsigned index) const {return m_str[index];}
+    const char *c_str() const {return m_str.c_str();}
+    unsigned length() const {return m_str.size();}
+
+private:
+    std::string m_str;
+};
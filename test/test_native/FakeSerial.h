@@ -0,0 +1,106 @@
+/**
+ * @file FakeSerial.h
+ *
+ * Scripted serial port for host side tests.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <deque>
+#include <functional>
+#include <initializer_list>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * Serial port which returns queued display data and passes each sent
+ * command (without 0xFF 0xFF 0xFF) to onCommand.
+ */
+class FakeSerial: public HardwareSerial
+{
+public:
+    int available() override
+    {
+        deliver();
+        return rx.size();
+    }
+
+    int read() override
+    {
+        deliver();
+        if(rx.empty())
+        {
+            return -1;
+        }
+        int c = rx.front();
+        rx.pop_front();
+        return c;
+    }
+
+    int peek() override
+    {
+        deliver();
+        return rx.empty() ? -1 : rx.front();
+    }
+
+    size_t write(uint8_t c) override
+    {
+        tx += (char)c;
+        if(tx.size() >= 3 && tx.compare(tx.size() - 3, 3, "\xFF\xFF\xFF") == 0)
+        {
+            std::string cmd = tx.substr(0, tx.size() - 3);
+            tx.clear();
+            commands.push_back(cmd);
+            if(onCommand)
+            {
+                onCommand(cmd);
+            }
+        }
+        return 1;
+    }
+    using Print::write;
+
+    /**
+     * Queue display data
+     */
+    void feed(std::initializer_list<uint8_t> data)
+    {
+        rx.insert(rx.end(), data.begin(), data.end());
+    }
+
+    /**
+     * Queue display data which arrives at given millis() time
+     */
+    void feedAt(uint32_t ms, std::initializer_list<uint8_t> data)
+    {
+        scheduled.emplace_back(ms, std::vector<uint8_t>(data));
+    }
+
+    void reset()
+    {
+        rx.clear();
+        tx.clear();
+        commands.clear();
+        scheduled.clear();
+        onCommand = nullptr;
+    }
+
+    std::deque<uint8_t> rx;
+    std::string tx;
+    std::deque<std::string> commands;
+    std::function<void(const std::string&)> onCommand;
+
+private:
+    void deliver()
+    {
+        while(!scheduled.empty() && (int32_t)(millis() - scheduled.front().first) >= 0)
+        {
+            rx.insert(rx.end(), scheduled.front().second.begin(), scheduled.front().second.end());
+            scheduled.pop_front();
+        }
+    }
+
+    std::deque<std::pair<uint32_t, std::vector<uint8_t>>> scheduled;
+};
@@ -0,0 +1,88 @@
+/**
+ * @file fake_arduino.cpp
+ *
+ * Arduino core functions for host side tests. Time advances on every
+ * clock read so receive waits terminate.
+ */
+
+#include <Arduino.h>
+#include <EEPROM.h>
+#include "fake_arduino.h"
+
+static uint32_t fakeMicros{0};
+static uint32_t fakeMillis{0};
+static uint32_t fakeMicrosOfMillis{0};
+
+// millis follows micros, but can be set independently to test wrap around
+static void advance(uint32_t us)
+{
+    fakeMicros += us;
+    fakeMicrosOfMillis += us;
+    fakeMillis += fakeMicrosOfMillis / 1000;
+    fakeMicrosOfMillis %= 1000;
+}
+
+void setMillis(uint32_t ms)
+{
+    fakeMillis = ms;
+    fakeMicrosOfMillis = 0;
+}
+
+void advanceMillis(uint32_t ms)
+{
+    advance(ms * 1000);
+}
+
+uint32_t millis()
+{
+    advance(50);
+    return fakeMillis;
+}
+
+uint32_t micros()
+{
+    advance(5);
+    return fakeMicros;
+}
+
+void delay(unsigned long ms)
+{
+    advance(ms * 1000);
+}
+
+void delayMicroseconds(unsigned int us)
+{
+    advance(us);
+}
+
+void yield()
+{
+    advance(10);
+}
+
+char *utoa(unsigned value, char *buffer, int radix)
+{
+    sprintf(buffer, radix == 16 ? "%x" : "%u", value);
+    return buffer;
+}
+
+char *itoa(int value, char *buffer, int)
+{
+    sprintf(buffer, "%d", value);
+    return buffer;
+}
+
+char *ltoa(long value, char *buffer, int)
+{
+    sprintf(buffer, "%ld", value);
+    return buffer;
+}
+
+char *ultoa(unsigned long value, char *buffer, int)
+{
+    sprintf(buffer, "%lu", value);
+    return buffer;
+}
+
+HardwareSerial Serial;
+EEPROMClass EEPROM;
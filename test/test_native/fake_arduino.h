@@ -0,0 +1,19 @@
+/**
+ * @file fake_arduino.h
+ *
+ * Test control of the fake Arduino clock.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * Set millis() value, micros() is not changed
+ */
+void setMillis(uint32_t ms);
+
+/**
+ * Advance millis() and micros()
+ */
+void advanceMillis(uint32_t ms);
@@ -0,0 +1,1167 @@
+/**
+ * @file test_main.cpp
+ *
+ * Host side tests of Nextion receive and command handling against a
+ * scripted serial port. Run with: pio test -e native
+ */
+
+#include <unity.h>
+#include "Nextion.h"
+#include "NexLog.h"
+#include "NexProfiler.h"
+#include "NexGesture.h"
+#include "NexHotspotGrid.h"
+#include "NexTimerWheel.h"
+#include "NexRegistry.h"
+#include <EEPROM.h>
+#include <vector>
+#include "FakeSerial.h"
+#include "fake_arduino.h"
+
+static FakeSerial serial;
+static Nextion *nextion;
+static NexPage *page0;
+static NexButton *b0;
+static NexNumber *n0;
+static NexTouch *listenList[3];
+
+static int pushCount;
+static int queryOnPush;
+static bool queryResult;
+static uint32_t queryValue;
+
+static void onPush(void *)
+{
+    if(++pushCount == queryOnPush)
+    {
+        queryResult = n0->getValue(&queryValue);
+    }
+}
+
+static void touchFrame(uint8_t cid)
+{
+    serial.feed({0x65, 0x00, cid, 0x01, 0xFF, 0xFF, 0xFF});
+}
+
+static void numberReply(uint8_t value)
+{
+    serial.feed({0x71, value, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF});
+}
+
+void setUp()
+{
+    serial.reset();
+    nextion = new Nextion(serial);
+    page0 = new NexPage(nextion, 0, "page0");
+    b0 = new NexButton(nextion, 0, 1, "b0", page0);
+    n0 = new NexNumber(nextion, 0, 2, "n0", page0);
+    listenList[0] = b0;
+    listenList[1] = n0;
+    listenList[2] = nullptr;
+    b0->attachPush(onPush);
+    pushCount = 0;
+    queryOnPush = 0;
+    queryResult = false;
+    queryValue = 0;
+}
+
+void tearDown()
+{
+    delete n0;
+    delete b0;
+    delete page0;
+    delete nextion;
+}
+
+// events which do not fit to event buffer are read when handled frames are reclaimed
+void test_event_buffer_full_reclaims_handled_frames()
+{
+    for(int i{0}; i < 12; ++i)
+    {
+        touchFrame(1);
+    }
+    queryOnPush = 5;
+    serial.onCommand = [](const std::string &cmd)
+    {
+        if(cmd.compare(0, 4, "get ") == 0)
+        {
+            numberReply(42);
+        }
+    };
+    nextion->nexLoop(listenList);
+    TEST_ASSERT_EQUAL(12, pushCount);
+    TEST_ASSERT_TRUE(queryResult);
+    TEST_ASSERT_EQUAL(42, queryValue);
+    TEST_ASSERT_EQUAL(0, nextion->GetResyncCount());
+    TEST_ASSERT_EQUAL(0, nextion->GetSkippedByteCount());
+}
+
+// reply behind an event which does not fit fails the request, no event is lost
+void test_event_buffer_full_keeps_pending_event()
+{
+    for(int i{0}; i < 12; ++i)
+    {
+        touchFrame(1);
+    }
+    queryOnPush = 1;
+    serial.onCommand = [](const std::string &cmd)
+    {
+        if(cmd.compare(0, 4, "get ") == 0)
+        {
+            numberReply(42);
+        }
+    };
+    nextion->setRetryPolicy(NEX_CMD_QUERY, NexRetryPolicy{0, 0, 0, 0});
+    nextion->nexLoop(listenList);
+    nextion->nexLoop(listenList);
+    TEST_ASSERT_EQUAL(12, pushCount);
+    TEST_ASSERT_FALSE(queryResult);
+    TEST_ASSERT_EQUAL(1, nextion->GetLateReplyCount());
+    TEST_ASSERT_EQUAL(0, nextion->GetUnexpectedReplyCount());
+    TEST_ASSERT_EQUAL(0, nextion->GetResyncCount());
+}
+
+// unknown frame is skipped up to its terminator, following frames are kept
+void test_resync_skips_unknown_frame()
+{
+    touchFrame(1);
+    serial.feed({0x33, 0x34, 0xFF, 0xFF, 0xFF});
+    touchFrame(1);
+    nextion->nexLoop(listenList);
+    nextion->nexLoop(listenList);
+    TEST_ASSERT_EQUAL(2, pushCount);
+    TEST_ASSERT_EQUAL(1, nextion->GetResyncCount());
+    TEST_ASSERT_EQUAL(5, nextion->GetSkippedByteCount());
+}
+
+// reply skipped by resync is not taken as reply of the request
+void test_resync_before_reply()
+{
+    serial.onCommand = [](const std::string &)
+    {
+        serial.feed({0x33, 0xFF, 0xFF, 0xFF});
+        numberReply(7);
+    };
+    uint32_t value{0};
+    TEST_ASSERT_TRUE(n0->getValue(&value));
+    TEST_ASSERT_EQUAL(7, value);
+    TEST_ASSERT_EQUAL(1, nextion->GetResyncCount());
+}
+
+// reply of timed out request is discarded when it arrives late
+void test_late_reply_is_discarded()
+{
+    int requests{0};
+    uint32_t start{millis()};
+    serial.onCommand = [&requests, start](const std::string &)
+    {
+        if(++requests == 1)
+        {
+            serial.feedAt(start + NEX_TIMEOUT_RETURN + 50, {0x71, 1, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF});
+        }
+        else
+        {
+            numberReply(2);
+        }
+    };
+    nextion->setRetryPolicy(NEX_CMD_QUERY, NexRetryPolicy{0, 0, 0, 0});
+    uint32_t value{0};
+    TEST_ASSERT_FALSE(n0->getValue(&value));
+    advanceMillis(100);
+    TEST_ASSERT_TRUE(n0->getValue(&value));
+    TEST_ASSERT_EQUAL(2, value);
+    TEST_ASSERT_EQUAL(1, nextion->GetLateReplyCount());
+}
+
+// reply which is not received before next command is lost, replies of later requests are not shifted
+void test_lost_reply()
+{
+    int requests{0};
+    serial.onCommand = [&requests](const std::string &)
+    {
+        if(++requests > 1)
+        {
+            numberReply(requests);
+        }
+    };
+    nextion->setRetryPolicy(NEX_CMD_QUERY, NexRetryPolicy{0, 0, 0, 0});
+    uint32_t value{0};
+    TEST_ASSERT_FALSE(n0->getValue(&value));
+    for(int i{2}; i <= 11; ++i)
+    {
+        TEST_ASSERT_TRUE(n0->getValue(&value));
+        TEST_ASSERT_EQUAL(i, value);
+    }
+    TEST_ASSERT_EQUAL(0, nextion->GetLateReplyCount());
+}
+
+// invalid instruction reply 0x00 0xFF 0xFF 0xFF is not taken as startup event
+void test_invalid_instruction_reply()
+{
+    serial.onCommand = [](const std::string &)
+    {
+        serial.feed({0x00, 0xFF, 0xFF, 0xFF});
+    };
+    nextion->sendCommand("xyz");
+    TEST_ASSERT_FALSE(nextion->recvRetCommandFinished());
+    TEST_ASSERT_EQUAL_HEX8(NEX_RET_INVALID_CMD, nextion->GetLastReturnCode());
+    TEST_ASSERT_EQUAL(0, nextion->GetResyncCount());
+}
+
+// assignment failing with invalid instruction is retried
+void test_invalid_instruction_retried()
+{
+    int requests{0};
+    serial.onCommand = [&requests](const std::string &)
+    {
+        if(++requests == 1)
+        {
+            serial.feed({0x00, 0xFF, 0xFF, 0xFF});
+        }
+        else
+        {
+            serial.feed({0x01, 0xFF, 0xFF, 0xFF});
+        }
+    };
+    TEST_ASSERT_TRUE(n0->setValue(5));
+    TEST_ASSERT_EQUAL(2, requests);
+    TEST_ASSERT_EQUAL(1, nextion->GetRetryCount());
+}
+
+static int startupCount;
+
+static void onStartup()
+{
+    ++startupCount;
+}
+
+// startup event 0x00 0x00 0x00 0xFF 0xFF 0xFF is queued as event
+void test_startup_event()
+{
+    startupCount = 0;
+    nextion->nextionStartupCallback = onStartup;
+    serial.feed({0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF});
+    touchFrame(1);
+    nextion->nexLoop(listenList);
+    TEST_ASSERT_EQUAL(1, startupCount);
+    TEST_ASSERT_EQUAL(1, pushCount);
+    TEST_ASSERT_EQUAL(0, nextion->GetUnexpectedReplyCount());
+}
+
+static int commandAttempts(const char *cmd)
+{
+    serial.reset();
+    nextion->sendCommand(cmd);
+    nextion->recvRetCommandFinished();
+    return serial.commands.size();
+}
+
+// only assignments of literal value are retried
+void test_retry_classification()
+{
+    TEST_ASSERT_EQUAL(1 + NEX_RETRY_MAX, commandAttempts("n0.val=5"));
+    TEST_ASSERT_EQUAL(1 + NEX_RETRY_MAX, commandAttempts("sys0=-5"));
+    TEST_ASSERT_EQUAL(1 + NEX_RETRY_MAX, commandAttempts("t0.txt=\"a+b=c\""));
+    TEST_ASSERT_EQUAL(1 + NEX_RETRY_MAX, commandAttempts("t0.txt=\"say \\\"hi\\\"\""));
+    TEST_ASSERT_EQUAL(1, commandAttempts("n0.val=n0.val+1"));
+    TEST_ASSERT_EQUAL(1, commandAttempts("t0.txt=t0.txt+\"a\""));
+    TEST_ASSERT_EQUAL(1, commandAttempts("sys0=sys0+1"));
+    TEST_ASSERT_EQUAL(1, commandAttempts("n0.val=5+1"));
+    TEST_ASSERT_EQUAL(1, commandAttempts("t0.txt=\"a\"+\"b\""));
+    TEST_ASSERT_EQUAL(1, commandAttempts("t0.txt+=\"a\""));
+    TEST_ASSERT_EQUAL(1, commandAttempts("ref n0"));
+}
+
+// late reply of the failed attempt during backoff answers the request, command is not resent
+void test_retry_reply_correlation()
+{
+    int requests{0};
+    uint32_t start{millis()};
+    serial.onCommand = [&requests, start](const std::string &)
+    {
+        if(++requests == 1)
+        {
+            // late, arrives during retry backoff
+            serial.feedAt(start + NEX_TIMEOUT_RETURN + 5, {0x71, 1, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF});
+        }
+        else
+        {
+            numberReply(2);
+        }
+    };
+    uint32_t value{0};
+    TEST_ASSERT_TRUE(n0->getValue(&value));
+    TEST_ASSERT_EQUAL(1, value);
+    TEST_ASSERT_EQUAL(1, requests);
+    TEST_ASSERT_EQUAL(0, nextion->GetRetryCount());
+    TEST_ASSERT_EQUAL(0, nextion->GetLateReplyCount());
+    nextion->nexLoop(listenList);
+    TEST_ASSERT_EQUAL(0, nextion->GetUnexpectedReplyCount());
+}
+
+// retried request after lost reply, later requests are answered normally
+void test_retry_after_lost_reply()
+{
+    int requests{0};
+    serial.onCommand = [&requests](const std::string &)
+    {
+        if(++requests > 1)
+        {
+            numberReply(requests);
+        }
+    };
+    uint32_t value{0};
+    for(int i{2}; i <= 11; ++i)
+    {
+        TEST_ASSERT_TRUE(n0->getValue(&value));
+        TEST_ASSERT_EQUAL(i, value);
+    }
+    TEST_ASSERT_EQUAL(1, nextion->GetRetryCount());
+    TEST_ASSERT_EQUAL(0, nextion->GetLateReplyCount());
+    nextion->nexLoop(listenList);
+    TEST_ASSERT_EQUAL(0, nextion->GetUnexpectedReplyCount());
+}
+
+// only pending assignments of literal value are replaced
+void test_coalescing_classification()
+{
+    serial.onCommand = [](const std::string &)
+    {
+        serial.feed({0x01, 0xFF, 0xFF, 0xFF});
+    };
+    TEST_ASSERT_TRUE(nextion->postCommand("n0.val=1"));
+    TEST_ASSERT_TRUE(nextion->postCommand("n0.val=2"));
+    TEST_ASSERT_TRUE(nextion->postCommand("sys0=sys0+1"));
+    TEST_ASSERT_TRUE(nextion->postCommand("sys0=sys0+1"));
+    TEST_ASSERT_TRUE(nextion->postCommand("t0.txt=t0.txt+\"a\""));
+    TEST_ASSERT_TRUE(nextion->postCommand("n0.val=3"));
+    TEST_ASSERT_TRUE(nextion->flushCommands());
+    TEST_ASSERT_EQUAL(1, nextion->GetCoalescedCommandCount());
+    TEST_ASSERT_EQUAL(5, serial.commands.size());
+    TEST_ASSERT_EQUAL_STRING("n0.val=2", serial.commands[0].c_str());
+    TEST_ASSERT_EQUAL_STRING("sys0=sys0+1", serial.commands[1].c_str());
+    TEST_ASSERT_EQUAL_STRING("sys0=sys0+1", serial.commands[2].c_str());
+    TEST_ASSERT_EQUAL_STRING("n0.val=3", serial.commands[4].c_str());
+}
+
+// log API links also when logging is compiled out
+void test_log_api()
+{
+    NexLog::dump(Serial);
+    NexLog::write(NEX_LOG_EVENT, 1);
+#if NEX_LOG_LEVEL <= NEX_LOG_LEVEL_OFF
+    TEST_ASSERT_EQUAL(0, NexLog::dump(Serial));
+    TEST_ASSERT_EQUAL(0, NexLog::GetOverwrittenCount());
+#else
+    TEST_ASSERT_EQUAL(1, NexLog::dump(Serial));
+#endif
+}
+
+static void comok()
+{
+    const char reply[] = "comok 1,30601-0,NX4832T035_011R,99,61488,D264B8204F0E1828,16777216";
+    serial.rx.insert(serial.rx.end(), reply, reply + sizeof(reply) - 1);
+    serial.feed({0xFF, 0xFF, 0xFF});
+}
+
+// return code of preceding command is skipped before comok
+void test_connect_skips_return_code()
+{
+    serial.feed({0x1A, 0xFF, 0xFF, 0xFF});
+    comok();
+    TEST_ASSERT_TRUE(nextion->RecvConnect(NEX_TIMEOUT_RETURN));
+}
+
+// garbage at wrong baud fails connect without waiting the timeout
+void test_connect_garbage_fails_immediately()
+{
+    serial.feed({0x83, 0x12, 0xF0});
+    uint32_t start{millis()};
+    TEST_ASSERT_FALSE(nextion->RecvConnect(NEX_TIMEOUT_RETURN));
+    TEST_ASSERT_LESS_OR_EQUAL(NEX_TIMEOUT_RETURN / 2, millis() - start);
+}
+
+static int32_t panelSys0;
+static uint32_t panelBaud;
+
+static void panelReply(uint8_t code)
+{
+    serial.feed({code, 0xFF, 0xFF, 0xFF});
+}
+
+// panel rejects sys0 assignments above 9600 baud but still answers get
+static void unstablePanel(const std::string &cmd)
+{
+    if(cmd == "connect")
+    {
+        comok();
+    }
+    else if(cmd.compare(0, 5, "baud=") == 0)
+    {
+        panelBaud = strtoul(cmd.c_str() + 5, nullptr, 10);
+    }
+    else if(cmd == "get sys0")
+    {
+        uint32_t v = panelSys0;
+        serial.feed({0x71, (uint8_t)v, (uint8_t)(v >> 8), (uint8_t)(v >> 16), (uint8_t)(v >> 24), 0xFF, 0xFF, 0xFF});
+    }
+    else if(cmd.compare(0, 5, "sys0=") == 0)
+    {
+        if(panelBaud > 9600)
+        {
+            panelReply(0x1A);
+        }
+        else
+        {
+            panelSys0 = strtol(cmd.c_str() + 5, nullptr, 10);
+            panelReply(0x01);
+        }
+    }
+}
+
+// echo after failed assignment is read, no reply is left behind
+void test_calibrate_failed_assignment()
+{
+    panelSys0 = 42;
+    panelBaud = 9600;
+    serial.onCommand = unstablePanel;
+    TEST_ASSERT_EQUAL(9600, nextion->calibrateBaud(19200, 2));
+    TEST_ASSERT_EQUAL(9600, panelBaud);
+    TEST_ASSERT_EQUAL(42, panelSys0);
+    TEST_ASSERT_EQUAL(0, serial.available());
+}
+
+static int gestures[NEX_GESTURE_SWIPE_DOWN + 1];
+
+static void onGesture(const NexGestureEvent &gesture, void *)
+{
+    ++gestures[gesture.type];
+}
+
+// double tap window is from first release to second press, second tap may be slow
+void test_double_tap_window()
+{
+    NexGesture gesture(nextion);
+    gesture.attachGesture(onGesture);
+    memset(gestures, 0, sizeof(gestures));
+    gesture.touchCoordinate(100, 100, NEX_EVENT_PUSH, 0);
+    gesture.touchCoordinate(100, 100, NEX_EVENT_POP, 50000);
+    gesture.touchCoordinate(101, 100, NEX_EVENT_PUSH, 300000);
+    gesture.touchCoordinate(101, 100, NEX_EVENT_POP, 420000);
+    TEST_ASSERT_EQUAL(1, gestures[NEX_GESTURE_DOUBLE_TAP]);
+    TEST_ASSERT_EQUAL(0, gestures[NEX_GESTURE_TAP]);
+}
+
+// layout of hundreds of cells fits default links, region is added only once
+void test_hotspot_grid_many_cells()
+{
+    NexHotspotGrid grid(nextion, 800, 480);
+    std::vector<NexVirtualHotspot> cells;
+    for(uint16_t y{0}; y < 480; y += 40)
+    {
+        for(uint16_t x{0}; x < 800; x += 40)
+        {
+            cells.emplace_back(x, y, 40, 40);
+        }
+    }
+    for(NexVirtualHotspot &cell : cells)
+    {
+        TEST_ASSERT_TRUE(grid.add(&cell));
+    }
+    uint16_t freeLinks{grid.GetFreeLinkCount()};
+    TEST_ASSERT_FALSE(grid.add(&cells[21]));
+    TEST_ASSERT_EQUAL(freeLinks, grid.GetFreeLinkCount());
+    TEST_ASSERT_EQUAL_PTR(&cells[21], grid.hitTest(60, 60));
+    TEST_ASSERT_TRUE(grid.remove(&cells[21]));
+    TEST_ASSERT_NULL(grid.hitTest(60, 60));
+}
+
+// region moved after add is removed from cells it was added to
+void test_hotspot_grid_remove_moved()
+{
+    NexHotspotGrid grid(nextion, 800, 480);
+    uint16_t freeLinks{grid.GetFreeLinkCount()};
+    NexVirtualHotspot button(10, 10, 50, 30);
+    TEST_ASSERT_TRUE(grid.add(&button));
+    TEST_ASSERT_EQUAL(freeLinks - 1, grid.GetFreeLinkCount());
+    button.x = 400;
+    button.w = 200;
+    TEST_ASSERT_FALSE(grid.add(&button));
+    TEST_ASSERT_TRUE(grid.remove(&button));
+    TEST_ASSERT_EQUAL(freeLinks, grid.GetFreeLinkCount());
+    TEST_ASSERT_NULL(grid.hitTest(20, 20));
+    TEST_ASSERT_FALSE(grid.remove(&button));
+    // added again to cells of new geometry
+    TEST_ASSERT_TRUE(grid.add(&button));
+    TEST_ASSERT_EQUAL(freeLinks - 2, grid.GetFreeLinkCount());
+    TEST_ASSERT_EQUAL_PTR(&button, grid.hitTest(550, 20));
+}
+
+static int timerFired;
+
+static void onTimer(void *)
+{
+    ++timerFired;
+}
+
+// timer expires on time when time since wheel start wraps around
+void test_timer_wheel_millis_wrap()
+{
+    setMillis(0);
+    NexTimerWheel wheel(7);
+    NexWheelTimer timer(onTimer);
+    timerFired = 0;
+    setMillis(0xFFFFFF00UL);
+    wheel.poll();
+    wheel.start(timer, 500);
+    advanceMillis(400);
+    wheel.poll();
+    TEST_ASSERT_EQUAL(0, timerFired);
+    advanceMillis(120);
+    wheel.poll();
+    TEST_ASSERT_EQUAL(1, timerFired);
+    TEST_ASSERT_LESS_OR_EQUAL(20, wheel.GetMaxJitter());
+}
+
+#if defined(NEX_ENABLE_PROFILER) && defined(NEX_SHORTEST_ADDRESSING)
+// id addressed commands are profiled under component name
+void test_profiler_site_of_id_addressing()
+{
+    NexNumber temperature(nextion, 0, 5, "temperature", page0);
+    serial.onCommand = [](const std::string &)
+    {
+        panelReply(0x01);
+    };
+    NexProfiler::reset();
+    TEST_ASSERT_TRUE(temperature.setValue(7));
+    TEST_ASSERT_TRUE(temperature.setVisible(false));
+    TEST_ASSERT_EQUAL_STRING("p[0].b[5].val=7", serial.commands[0].c_str());
+    TEST_ASSERT_EQUAL_STRING("vis 5,0", serial.commands[1].c_str());
+    TEST_ASSERT_EQUAL(2, NexProfiler::GetEntryCount());
+    TEST_ASSERT_EQUAL_STRING("page0.temperature.val=", NexProfiler::GetEntry(0).site);
+    TEST_ASSERT_EQUAL_STRING("vis temperature", NexProfiler::GetEntry(1).site);
+}
+#endif
+
+// serial buffer holding size - 1 bytes is full, frame error while draining it is overflow suspect
+void test_rx_buffer_full()
+{
+    for(int i{0}; i < 8; ++i)
+    {
+        touchFrame(5);
+    }
+    serial.feed({0x99, 0x01, 0x02, 0x03, 0xFF, 0xFF, 0xFF});
+    TEST_ASSERT_EQUAL(NEX_SERIAL_RX_BUFFER_SIZE - 1, serial.available());
+    nextion->nexLoop(listenList);
+    TEST_ASSERT_EQUAL(1, nextion->GetRxFullCount());
+    TEST_ASSERT_EQUAL(1, nextion->GetFrameErrorCount());
+    TEST_ASSERT_EQUAL(1, nextion->GetRxOverflowSuspectCount());
+}
+
+// frame error after full buffer is drained is not overflow suspect
+void test_rx_buffer_full_drained()
+{
+    for(int i{0}; i < 9; ++i)
+    {
+        touchFrame(5);
+    }
+    nextion->nexLoop(listenList);
+    TEST_ASSERT_EQUAL(1, nextion->GetRxFullCount());
+    nextion->nexLoop(listenList);
+    serial.feed({0x99, 0x01, 0x02, 0x03, 0xFF, 0xFF, 0xFF});
+    nextion->nexLoop(listenList);
+    TEST_ASSERT_EQUAL(1, nextion->GetFrameErrorCount());
+    TEST_ASSERT_EQUAL(0, nextion->GetRxOverflowSuspectCount());
+}
+
+// immediate assignment is not overwritten by value posted before it
+void test_set_after_post_keeps_order()
+{
+    NexVariable va0(nextion, 0, 3, "va0", page0);
+    serial.onCommand = [](const std::string &)
+    {
+        panelReply(0x01);
+    };
+    TEST_ASSERT_TRUE(va0.postValue(-2000000000));
+    TEST_ASSERT_TRUE(n0->postValue(1));
+    TEST_ASSERT_TRUE(va0.setValue(7));
+    TEST_ASSERT_EQUAL(3, serial.commands.size());
+    TEST_ASSERT_EQUAL_STRING("page0.va0.val=-2000000000", serial.commands[0].c_str());
+    TEST_ASSERT_EQUAL_STRING("page0.n0.val=1", serial.commands[1].c_str());
+    TEST_ASSERT_EQUAL_STRING("page0.va0.val=7", serial.commands[2].c_str());
+    nextion->nexLoop(listenList);
+    TEST_ASSERT_EQUAL(3, serial.commands.size());
+}
+
+static int valueChanges;
+static int32_t changedValue;
+
+static void onValueChange(int32_t value, void *)
+{
+    ++valueChanges;
+    changedValue = value;
+}
+
+static void valueChangeFrame(uint8_t cid, uint32_t value)
+{
+    serial.feed({NEX_RET_VALUE_CHANGE_HEAD, 0x00, cid, (uint8_t)value, (uint8_t)(value >> 8),
+        (uint8_t)(value >> 16), (uint8_t)(value >> 24), 0xFF, 0xFF, 0xFF});
+}
+
+// value change frame updates cache, callback is called only when value changes
+void test_value_change_cache()
+{
+    n0->attachValueChange(onValueChange);
+    valueChanges = 0;
+    uint32_t cached{0};
+    TEST_ASSERT_FALSE(n0->getCachedValue(&cached));
+    valueChangeFrame(2, 300);
+    nextion->nexLoop(listenList);
+    valueChangeFrame(2, 300);
+    nextion->nexLoop(listenList);
+    TEST_ASSERT_EQUAL(1, valueChanges);
+    TEST_ASSERT_EQUAL(300, changedValue);
+    TEST_ASSERT_TRUE(n0->getCachedValue(&cached));
+    TEST_ASSERT_EQUAL(300, cached);
+    // setter updates cache without callback
+    serial.onCommand = [](const std::string &)
+    {
+        panelReply(0x01);
+    };
+    TEST_ASSERT_TRUE(n0->setValue(5));
+    TEST_ASSERT_TRUE(n0->getCachedValue(&cached));
+    TEST_ASSERT_EQUAL(5, cached);
+    TEST_ASSERT_EQUAL(1, valueChanges);
+}
+
+void test_value_change_snippet()
+{
+    String snippet;
+    n0->getValueChangeSnippet(snippet);
+    TEST_ASSERT_EQUAL_STRING("printh 72\r\nprints dp,1\r\nprints n0.id,1\r\nprints n0.val,4\r\nprinth FF FF FF\r\n", snippet.c_str());
+}
+
+static std::string listenerCalls;
+
+static void listenerC(void *)
+{
+    listenerCalls += 'C';
+}
+
+static void listenerD(void *)
+{
+    listenerCalls += 'D';
+}
+
+static void listenerA(void *)
+{
+    listenerCalls += 'A';
+    // removes itself
+    b0->removeListener(listenerA);
+}
+
+static void listenerB(void *)
+{
+    listenerCalls += 'B';
+    // removes following listener and adds new one to the end
+    b0->removeListener(listenerC);
+    b0->addPushListener(listenerD);
+}
+
+// listeners may be added and removed from listener callback
+void test_listener_add_remove_during_dispatch()
+{
+    listenerCalls.clear();
+    TEST_ASSERT_TRUE(b0->addPushListener(listenerA));
+    TEST_ASSERT_TRUE(b0->addPushListener(listenerB));
+    TEST_ASSERT_TRUE(b0->addPushListener(listenerC));
+    touchFrame(1);
+    nextion->nexLoop(listenList);
+    TEST_ASSERT_EQUAL_STRING("ABD", listenerCalls.c_str());
+    TEST_ASSERT_FALSE(b0->removeListener(listenerA));
+    TEST_ASSERT_TRUE(b0->removeListener(listenerB));
+    listenerCalls.clear();
+    touchFrame(1);
+    nextion->nexLoop(listenList);
+    TEST_ASSERT_EQUAL_STRING("D", listenerCalls.c_str());
+    // released slots are reused
+    for(int i{1}; i < NEX_MAX_LISTENERS; ++i)
+    {
+        TEST_ASSERT_TRUE(n0->addPopListener(listenerC));
+    }
+    TEST_ASSERT_FALSE(n0->addPopListener(listenerC));
+}
+
+static std::vector<std::vector<uint8_t>> customFrames;
+
+static void onCustomFrame(const NexEventFrame &frame, void *ptr)
+{
+    customFrames.emplace_back(frame.data(), frame.data() + frame.length());
+    *(uint8_t*)ptr = frame.header();
+}
+
+// custom fixed length and terminated frames are dispatched, unregistered frame is skipped
+void test_custom_event_frames()
+{
+    customFrames.clear();
+    uint8_t header{0};
+    TEST_ASSERT_FALSE(nextion->registerCustomEvent(0x65, 7, onCustomFrame, &header));
+    TEST_ASSERT_TRUE(nextion->registerCustomEvent(0xA0, 5, onCustomFrame, &header));
+    TEST_ASSERT_TRUE(nextion->registerCustomEvent(0xA1, 0, onCustomFrame, &header));
+    serial.feed({0xA0, 0x01, 0xFF, 0x03, 0x04});
+    serial.feed({0xA1, 'h', 'i', 0xFF, 0xFF, 0xFF});
+    touchFrame(1);
+    nextion->nexLoop(listenList);
+    nextion->nexLoop(listenList);
+    TEST_ASSERT_EQUAL(2, customFrames.size());
+    TEST_ASSERT_TRUE((customFrames[0] == std::vector<uint8_t>{0xA0, 0x01, 0xFF, 0x03, 0x04}));
+    TEST_ASSERT_TRUE((customFrames[1] == std::vector<uint8_t>{0xA1, 'h', 'i', 0xFF, 0xFF, 0xFF}));
+    TEST_ASSERT_EQUAL(0xA1, header);
+    TEST_ASSERT_EQUAL(1, pushCount);
+    TEST_ASSERT_EQUAL(0, nextion->GetResyncCount());
+
+    TEST_ASSERT_TRUE(nextion->unregisterCustomEvent(0xA0));
+    TEST_ASSERT_FALSE(nextion->unregisterCustomEvent(0xA0));
+    serial.feed({0xA0, 0x01, 0xFF, 0xFF, 0xFF});
+    touchFrame(1);
+    nextion->nexLoop(listenList);
+    nextion->nexLoop(listenList);
+    TEST_ASSERT_EQUAL(2, customFrames.size());
+    TEST_ASSERT_EQUAL(2, pushCount);
+    TEST_ASSERT_EQUAL(1, nextion->GetResyncCount());
+}
+
+static int dataWaits;
+
+static void onWaitForData(uint32_t maxWait)
+{
+    ++dataWaits;
+    advanceMillis(maxWait < 5 ? maxWait : 5);
+}
+
+// readBytes waits in wait callback until rest of data arrives, wait time is reported
+void test_read_bytes_waits_in_callback()
+{
+    nextion->waitForDataCallback = onWaitForData;
+    dataWaits = 0;
+    uint32_t waitTime{nextion->GetReceiveWaitTime()};
+    serial.feed({1, 2, 3});
+    serial.feedAt(millis() + 20, {4, 5, 6});
+    uint8_t buffer[8]{0};
+    TEST_ASSERT_EQUAL(6, nextion->readBytes(buffer, 6, 100));
+    TEST_ASSERT_TRUE((std::vector<uint8_t>(buffer, buffer + 6) == std::vector<uint8_t>{1, 2, 3, 4, 5, 6}));
+    TEST_ASSERT_TRUE(dataWaits >= 3);
+    TEST_ASSERT_TRUE(dataWaits <= 5);
+    TEST_ASSERT_TRUE(nextion->GetReceiveWaitTime() - waitTime >= 15000);
+    // timeout returns bytes received so far
+    serial.feed({7});
+    TEST_ASSERT_EQUAL(1, nextion->readBytes(buffer, 2, 30));
+    TEST_ASSERT_EQUAL(7, buffer[0]);
+}
+
+static void stringReply(const std::string &text)
+{
+    serial.feed({0x70});
+    serial.rx.insert(serial.rx.end(), text.begin(), text.end());
+    serial.feed({0xFF, 0xFF, 0xFF});
+}
+
+static void onStringChunk(const char *chunk, size_t len, void *ptr)
+{
+    std::vector<std::string> &chunks = *(std::vector<std::string>*)ptr;
+    chunks.emplace_back(chunk, len);
+}
+
+// string is passed to sink in chunks, buffer receive reports truncation
+void test_string_sink_chunks()
+{
+    std::string text;
+    for(int i{0}; i < 40; ++i)
+    {
+        text += (char)('a' + i % 26);
+    }
+    stringReply(text);
+    std::vector<std::string> chunks;
+    TEST_ASSERT_TRUE(nextion->recvRetString(onStringChunk, &chunks));
+    TEST_ASSERT_EQUAL(3, chunks.size());
+    TEST_ASSERT_EQUAL(NEX_STRING_CHUNK_SIZE, chunks[0].size());
+    TEST_ASSERT_EQUAL(NEX_STRING_CHUNK_SIZE, chunks[1].size());
+    TEST_ASSERT_EQUAL_STRING(text.c_str(), (chunks[0] + chunks[1] + chunks[2]).c_str());
+
+    stringReply(text);
+    char buffer[11];
+    uint16_t len{sizeof(buffer)};
+    bool truncated{false};
+    TEST_ASSERT_TRUE(nextion->recvRetString(buffer, len, truncated));
+    TEST_ASSERT_TRUE(truncated);
+    // full buffer is not null terminated
+    TEST_ASSERT_EQUAL(sizeof(buffer), len);
+    TEST_ASSERT_EQUAL_STRING(text.substr(0, len).c_str(), std::string(buffer, len).c_str());
+
+    stringReply("short");
+    len = sizeof(buffer);
+    TEST_ASSERT_TRUE(nextion->recvRetString(buffer, len, truncated));
+    TEST_ASSERT_FALSE(truncated);
+    TEST_ASSERT_EQUAL(5, len);
+    TEST_ASSERT_EQUAL_STRING("short", buffer);
+}
+
+// queued command is dropped when its deadline passes, expired commands make room in full queue
+void test_deadline_drops_stale_commands()
+{
+    serial.onCommand = [](const std::string &)
+    {
+        panelReply(0x01);
+    };
+    TEST_ASSERT_TRUE(nextion->postCommand("n0.val=1", 50));
+    TEST_ASSERT_TRUE(nextion->postCommand("page 1"));
+    TEST_ASSERT_TRUE(n0->postValue(2, 500));
+    advanceMillis(100);
+    TEST_ASSERT_TRUE(nextion->flushCommands());
+    TEST_ASSERT_EQUAL(1, nextion->GetStaleCommandCount());
+    TEST_ASSERT_EQUAL(2, serial.commands.size());
+    TEST_ASSERT_EQUAL_STRING("page 1", serial.commands[0].c_str());
+    TEST_ASSERT_TRUE(serial.commands[1].find(".val=2") != std::string::npos);
+
+    serial.commands.clear();
+    int queued{0};
+    while(nextion->postCommand("sys0=sys0+1", 50))
+    {
+        ++queued;
+    }
+    TEST_ASSERT_TRUE(queued > 1);
+    advanceMillis(100);
+    TEST_ASSERT_TRUE(nextion->postCommand("page 2"));
+    TEST_ASSERT_TRUE(nextion->flushCommands());
+    TEST_ASSERT_EQUAL(1 + queued, nextion->GetStaleCommandCount());
+    TEST_ASSERT_EQUAL(1, serial.commands.size());
+    TEST_ASSERT_EQUAL_STRING("page 2", serial.commands[0].c_str());
+}
+
+// non-blocking init advances from nexLoop, posted commands wait until init is done
+void test_init_poll_state_machine()
+{
+    serial.onCommand = [](const std::string &cmd)
+    {
+        if(cmd == "connect")
+        {
+            comok();
+        }
+        else if(!cmd.empty())
+        {
+            panelReply(0x01);
+        }
+    };
+    TEST_ASSERT_EQUAL(NEX_INIT_IDLE, nextion->GetInitState());
+    TEST_ASSERT_TRUE(nextion->postCommand("page 1"));
+    nextion->nexInitBegin();
+    TEST_ASSERT_EQUAL(NEX_INIT_CONNECT, nextion->GetInitState());
+    std::vector<NexInitState> states;
+    for(int i{0}; i < 20 && nextion->GetInitState() != NEX_INIT_DONE; ++i)
+    {
+        uint32_t start{millis()};
+        nextion->nexLoop(listenList);
+        TEST_ASSERT_TRUE(millis() - start < 5);
+        if(states.empty() || states.back() != nextion->GetInitState())
+        {
+            states.push_back(nextion->GetInitState());
+        }
+    }
+    TEST_ASSERT_EQUAL(NEX_INIT_DONE, nextion->GetInitState());
+    TEST_ASSERT_TRUE((states == std::vector<NexInitState>{NEX_INIT_CONNECT, NEX_INIT_SETUP, NEX_INIT_DONE}));
+    TEST_ASSERT_EQUAL(5, serial.commands.size());
+    TEST_ASSERT_EQUAL_STRING("connect", serial.commands[1].c_str());
+    TEST_ASSERT_EQUAL_STRING("bkcmd=3", serial.commands[2].c_str());
+    TEST_ASSERT_EQUAL_STRING("page 0", serial.commands[3].c_str());
+    TEST_ASSERT_EQUAL_STRING("page 1", serial.commands[4].c_str());
+}
+
+// init fails when display does not answer at any baud rate
+void test_init_poll_no_display()
+{
+    nextion->nexInitBegin();
+    for(int i{0}; i < 1000 && nextion->GetInitState() < NEX_INIT_DONE; ++i)
+    {
+        nextion->nexInitPoll();
+        advanceMillis(10);
+    }
+    TEST_ASSERT_EQUAL(NEX_INIT_FAILED, nextion->GetInitState());
+    // default baud and every supported baud probed once
+    TEST_ASSERT_TRUE(serial.commands.size() > 4);
+    for(const std::string &cmd : serial.commands)
+    {
+        TEST_ASSERT_TRUE(cmd.empty() || cmd == "connect");
+    }
+}
+
+#ifdef NEX_ENABLE_DISCOVERY
+// page 1: page, button at 10,20 80x40, number at 100,20 60x40
+static void registryPanel(const std::string &cmd)
+{
+    unsigned pid, cid;
+    char attribute[8];
+    if(sscanf(cmd.c_str(), "get p[%u].b[%u].%7s", &pid, &cid, attribute) != 3 || pid != 1 || cid > 2)
+    {
+        // invalid variable name
+        panelReply(0x1A);
+        return;
+    }
+    static const int32_t types[]{NEX_TYPE_PAGE, NEX_TYPE_BUTTON, NEX_TYPE_NUMBER};
+    int32_t value{0};
+    std::string name{attribute};
+    if(name == "type")
+    {
+        value = types[cid];
+    }
+    else if(cid)
+    {
+        value = name == "x" ? 10 + 90 * (cid - 1) : name == "y" ? 20 : name == "w" ? 80 - 20 * (cid - 1) : 40;
+    }
+    serial.feed({0x71, (uint8_t)value, (uint8_t)(value >> 8), (uint8_t)(value >> 16), (uint8_t)(value >> 24), 0xFF, 0xFF, 0xFF});
+}
+
+// discovered page is found by id and type and restored from EEPROM cache of the same fingerprint
+void test_registry_discovery_cache()
+{
+    serial.onCommand = registryPanel;
+    NexRegistry registry(nextion);
+    uint32_t fingerprint{0};
+    TEST_ASSERT_TRUE(registry.typeFingerprint(1, fingerprint));
+    TEST_ASSERT_FALSE(registry.load(fingerprint));
+    TEST_ASSERT_EQUAL(3, registry.discoverPage(1));
+    const NexComponentInfo *number = registry.findByType(1, NEX_TYPE_NUMBER);
+    TEST_ASSERT_EQUAL_PTR(registry.find(1, 2), number);
+    TEST_ASSERT_EQUAL(100, number->x);
+    TEST_ASSERT_EQUAL(60, number->w);
+    TEST_ASSERT_NULL(registry.findByType(1, NEX_TYPE_BUTTON, 1));
+    registry.save();
+
+    serial.commands.clear();
+    NexRegistry cached(nextion);
+    TEST_ASSERT_TRUE(cached.load(fingerprint));
+    TEST_ASSERT_EQUAL(0, serial.commands.size());
+    TEST_ASSERT_EQUAL(3, cached.GetCount());
+    const NexComponentInfo *button = cached.findByType(1, NEX_TYPE_BUTTON);
+    TEST_ASSERT_EQUAL_PTR(cached.find(1, 1), button);
+    TEST_ASSERT_EQUAL(10, button->x);
+    TEST_ASSERT_EQUAL(20, button->y);
+    TEST_ASSERT_EQUAL(80, button->w);
+    TEST_ASSERT_EQUAL(40, button->h);
+    // other TFT
+    TEST_ASSERT_FALSE(cached.load(fingerprint + 1));
+    TEST_ASSERT_EQUAL(0, cached.GetCount());
+    // unchanged registry is not rewritten
+    uint32_t writes{EEPROM.writes};
+    registry.save();
+    TEST_ASSERT_EQUAL(writes + 2, EEPROM.writes);
+}
+#endif
+
+// span views any contiguous buffer, bulk APIs take spans longer than uint16_t
+void test_span_bulk_apis()
+{
+    uint8_t array[4]{1, 2, 3, 4};
+    NexSpan<uint8_t> span(array);
+    TEST_ASSERT_EQUAL(4, span.size());
+    TEST_ASSERT_EQUAL(3, span.subspan(1, 2)[1]);
+    TEST_ASSERT_EQUAL(1, span.subspan(3, 10).size());
+    TEST_ASSERT_TRUE(span.subspan(5, 1).empty());
+    std::vector<uint8_t> raw(70000, 0x55);
+    NexSpan<const uint8_t> rawSpan = nexSpan(raw);
+    TEST_ASSERT_EQUAL_PTR(raw.data(), rawSpan.data());
+    nextion->sendRawData(rawSpan);
+    TEST_ASSERT_EQUAL(raw.size(), serial.tx.size());
+    serial.tx.clear();
+
+    serial.onCommand = [](const std::string &cmd)
+    {
+        if(cmd.find("addt ") != std::string::npos)
+        {
+            // data mode ready and finished
+            serial.feed({0xFE, 0xFF, 0xFF, 0xFF});
+            serial.feed({0xFD, 0xFF, 0xFF, 0xFF});
+        }
+    };
+    NexWaveform s0(nextion, 0, 3, "s0", page0);
+    std::vector<uint16_t> values(300, 100);
+    TEST_ASSERT_TRUE(s0.addValues(1, values));
+    // raw values precede next command in tx
+    TEST_ASSERT_EQUAL(3, serial.commands.size());
+    TEST_ASSERT_EQUAL_STRING("addt 3,1,124", serial.commands[0].c_str());
+    TEST_ASSERT_EQUAL_STRING("addt 3,1,124", serial.commands[1].substr(124).c_str());
+    TEST_ASSERT_EQUAL_STRING("addt 3,1,52", serial.commands[2].substr(124).c_str());
+    TEST_ASSERT_EQUAL(52, serial.tx.size());
+}
+
+static uint32_t frameTime;
+static uint32_t pushEventTime;
+
+static void onEventFrame(const NexEventFrame &frame)
+{
+    frameTime = frame.time();
+}
+
+static void onTimedPush(void *)
+{
+    pushEventTime = nextion->GetCurrentEventTime();
+}
+
+// event read during command is stamped on arrival, its queue delay is measured when it is handled
+void test_event_time_and_queue_delay()
+{
+    nextion->eventFrameCallback = onEventFrame;
+    b0->attachPush(onTimedPush);
+    serial.onCommand = [](const std::string &)
+    {
+        touchFrame(1);
+        numberReply(3);
+    };
+    uint32_t before{micros()};
+    uint32_t value{0};
+    TEST_ASSERT_TRUE(n0->getValue(&value));
+    uint32_t after{micros()};
+    advanceMillis(20);
+    nextion->nexLoop(listenList);
+    TEST_ASSERT_TRUE(frameTime - before <= after - before);
+    TEST_ASSERT_EQUAL(frameTime, pushEventTime);
+    TEST_ASSERT_EQUAL(1, nextion->GetEventCount());
+    TEST_ASSERT_TRUE(nextion->GetEventQueueDelayMax() >= 20000);
+    TEST_ASSERT_TRUE(nextion->GetEventQueueDelayMax() < 21000);
+    TEST_ASSERT_EQUAL(nextion->GetEventQueueDelayMax(), nextion->GetEventQueueDelayAverage());
+
+    // event handled right after arrival
+    touchFrame(1);
+    nextion->nexLoop(listenList);
+    TEST_ASSERT_EQUAL(2, nextion->GetEventCount());
+    TEST_ASSERT_TRUE(nextion->GetEventQueueDelayAverage() >= 10000);
+    TEST_ASSERT_TRUE(nextion->GetEventQueueDelayAverage() < 11000);
+    nextion->resetEventStatistics();
+    TEST_ASSERT_EQUAL(0, nextion->GetEventCount());
+    TEST_ASSERT_EQUAL(0, nextion->GetEventQueueDelayMax());
+}
+
+// instance configuration sets timeouts and ack mode, capacities are clamped to buffers
+void test_instance_config()
+{
+    NexInstanceConfig config;
+    config.returnTimeout = NEX_TIMEOUT_RETURN + 30;
+    config.commandQueueSize = 1000;
+    config.eventBufferSize = 1000;
+    nextion->setConfig(config);
+    TEST_ASSERT_EQUAL(NEX_TIMEOUT_RETURN + 30, nextion->GetConfig().returnTimeout);
+    TEST_ASSERT_EQUAL(NEX_COMMAND_QUEUE_SIZE, nextion->GetConfig().commandQueueSize);
+    TEST_ASSERT_EQUAL(NEX_EVENT_BUFFER_SIZE, nextion->GetConfig().eventBufferSize);
+
+    // other instance keeps defaults
+    FakeSerial serial2;
+    Nextion nextion2(serial2);
+    TEST_ASSERT_EQUAL(NEX_TIMEOUT_RETURN, nextion2.GetConfig().returnTimeout);
+
+    nextion->setRetryPolicy(NEX_CMD_QUERY, NexRetryPolicy{0, 0, 0, 0});
+    uint32_t value;
+    uint32_t start{millis()};
+    TEST_ASSERT_FALSE(n0->getValue(&value));
+    uint32_t elapsed{millis() - start};
+    TEST_ASSERT_TRUE(elapsed >= NEX_TIMEOUT_RETURN + 30);
+    TEST_ASSERT_TRUE(elapsed < NEX_TIMEOUT_RETURN + 40);
+
+    // smaller command queue
+    config.commandQueueSize = 24;
+    nextion->setConfig(config);
+    TEST_ASSERT_EQUAL(24, nextion->GetConfig().commandQueueSize);
+    int queued{0};
+    while(nextion->postCommand("sys0=sys0+1"))
+    {
+        ++queued;
+    }
+    // entry is expiry time and terminated command, 16 bytes
+    TEST_ASSERT_EQUAL(1, queued);
+
+    // failures only, assignment is not waited
+    nextion->flushCommands();
+    config.ackMode = NEX_ACK_FAILURES;
+    nextion->setConfig(config);
+    start = millis();
+    TEST_ASSERT_TRUE(n0->setValue(5));
+    TEST_ASSERT_TRUE(millis() - start < 5);
+}
+
+static std::vector<NexEventFrame> seenFrames;
+
+static void collectFrame(const NexEventFrame &frame)
+{
+    seenFrames.push_back(frame);
+}
+
+// handler gets view to frame bytes with typed accessors
+void test_event_frame_view()
+{
+    seenFrames.clear();
+    nextion->eventFrameCallback = collectFrame;
+    touchFrame(1);
+    serial.feed({0x66, 0x02, 0xFF, 0xFF, 0xFF});
+    serial.feed({0x67, 0x01, 0x40, 0x00, 0xF0, 0x00, 0xFF, 0xFF, 0xFF});
+    valueChangeFrame(2, 0xFFFFFFFE);
+    nextion->nexLoop(listenList);
+    TEST_ASSERT_EQUAL(4, seenFrames.size());
+    TEST_ASSERT_EQUAL(0x65, seenFrames[0].header());
+    TEST_ASSERT_EQUAL(1, seenFrames[0].componentId());
+    TEST_ASSERT_EQUAL(NEX_EVENT_PUSH, seenFrames[0].touchEvent());
+    TEST_ASSERT_EQUAL(2, seenFrames[1].pageId());
+    TEST_ASSERT_EQUAL(320, seenFrames[2].x());
+    TEST_ASSERT_EQUAL(240, seenFrames[2].y());
+    TEST_ASSERT_EQUAL(NEX_EVENT_POP, seenFrames[2].touchEvent());
+    TEST_ASSERT_EQUAL(-2, seenFrames[3].value());
+    // frames are views to one receive buffer, not copies
+    TEST_ASSERT_TRUE(seenFrames[1].data() > seenFrames[0].data());
+    TEST_ASSERT_TRUE(seenFrames[3].data() - seenFrames[0].data() < NEX_EVENT_BUFFER_SIZE);
+}
+
+int main(int, char **)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_event_buffer_full_reclaims_handled_frames);
+    RUN_TEST(test_event_buffer_full_keeps_pending_event);
+    RUN_TEST(test_resync_skips_unknown_frame);
+    RUN_TEST(test_resync_before_reply);
+    RUN_TEST(test_late_reply_is_discarded);
+    RUN_TEST(test_lost_reply);
+    RUN_TEST(test_invalid_instruction_reply);
+    RUN_TEST(test_invalid_instruction_retried);
+    RUN_TEST(test_startup_event);
+    RUN_TEST(test_retry_classification);
+    RUN_TEST(test_retry_reply_correlation);
+    RUN_TEST(test_retry_after_lost_reply);
+    RUN_TEST(test_coalescing_classification);
+    RUN_TEST(test_set_after_post_keeps_order);
+    RUN_TEST(test_log_api);
+    RUN_TEST(test_connect_skips_return_code);
+    RUN_TEST(test_connect_garbage_fails_immediately);
+    RUN_TEST(test_calibrate_failed_assignment);
+    RUN_TEST(test_value_change_cache);
+    RUN_TEST(test_value_change_snippet);
+    RUN_TEST(test_listener_add_remove_during_dispatch);
+    RUN_TEST(test_rx_buffer_full);
+    RUN_TEST(test_rx_buffer_full_drained);
+    RUN_TEST(test_double_tap_window);
+    RUN_TEST(test_hotspot_grid_many_cells);
+    RUN_TEST(test_hotspot_grid_remove_moved);
+    RUN_TEST(test_timer_wheel_millis_wrap);
+    RUN_TEST(test_event_frame_view);
+    RUN_TEST(test_instance_config);
+    RUN_TEST(test_event_time_and_queue_delay);
+    RUN_TEST(test_span_bulk_apis);
+    RUN_TEST(test_init_poll_state_machine);
+    RUN_TEST(test_init_poll_no_display);
+    RUN_TEST(test_deadline_drops_stale_commands);
+    RUN_TEST(test_string_sink_chunks);
+    RUN_TEST(test_read_bytes_waits_in_callback);
+    RUN_TEST(test_custom_event_frames);
+#if defined(NEX_ENABLE_PROFILER) && defined(NEX_SHORTEST_ADDRESSING)
+    RUN_TEST(test_profiler_site_of_id_addressing);
+#endif
+#ifdef NEX_ENABLE_DISCOVERY
+    RUN_TEST(test_registry_discovery_cache);
+#endif
+    return UNITY_END();
+}
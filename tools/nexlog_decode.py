@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+"""Decode binary log dumped with NexLog::dump.
+
+Event format strings are read from the comments of NexLogEvent enum in
+include/NexLog.h, so the decoder follows the library version it is run from.
+
+usage: nexlog_decode.py [-H NexLog.h] [dump.bin]   (reads stdin if no file)
+"""
+import argparse
+import os
+import re
+import struct
+import sys
+
+RECORD = struct.Struct('<BIi')
+HEADER = struct.Struct('<3sBHI')
+
+
+def read_events(header_path):
+    events = []
+    in_enum = False
+    with open(header_path) as f:
+        for line in f:
+            if line.startswith('enum NexLogEvent'):
+                in_enum = True
+            elif in_enum and line.startswith('};'):
+                break
+            elif in_enum:
+                m = re.match(r'\s*(NEX_LOG_\w+),?\s*//\s*(.*)', line)
+                if m:
+                    events.append((m.group(1), m.group(2).strip()))
+    return events
+
+
+def decode(data, events, out):
+    pos = data.find(b'NXL')
+    while pos >= 0:
+        magic, version, count, overwritten = HEADER.unpack_from(data, pos)
+        if version != 1:
+            sys.exit('unsupported log format version %d' % version)
+        pos += HEADER.size
+        if overwritten:
+            out.write('(%d older records overwritten)\n' % overwritten)
+        first = None
+        for _ in range(count):
+            if pos + RECORD.size > len(data):
+                out.write('(truncated dump)\n')
+                return
+            event, time, arg = RECORD.unpack_from(data, pos)
+            pos += RECORD.size
+            if first is None:
+                first = time
+            name, fmt = events[event] if event < len(events) else ('?', 'unknown event %d' % event)
+            text = fmt.replace('%d', str(arg))
+            out.write('%12d us  %-28s %s\n' % ((time - first) & 0xFFFFFFFF, name, text))
+        pos = data.find(b'NXL', pos)
+
+
+def main():
+    default_header = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'include', 'NexLog.h')
+    parser = argparse.ArgumentParser(description='Decode NexLog binary dump')
+    parser.add_argument('-H', '--header', default=default_header, help='path to NexLog.h')
+    parser.add_argument('dump', nargs='?', help='binary dump file, default stdin')
+    args = parser.parse_args()
+    events = read_events(args.header)
+    if args.dump:
+        with open(args.dump, 'rb') as f:
+            data = f.read()
+    else:
+        data = sys.stdin.buffer.read()
+    decode(data, events, sys.stdout)
+
+
+if __name__ == '__main__':
+    main()